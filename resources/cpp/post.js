@@ -8,7 +8,18 @@ return {
 
   Geometry: {
     Line: Module.geometry_line,
-    Circle: Module.geometry_circle
+    Circle: Module.geometry_circle,
+    DistanceField: Module.geometry_distance_field
+  },
+
+  Graphics: {
+    TrailBuffer: Module.graphics_trail_buffer
+  },
+
+  Simulation: {
+    World: Module.simulation_world,
+    WorldView: Module.simulation_world_view,
+    Pipeline: Module.simulation_pipeline
   }
 };
 
@@ -90,6 +90,113 @@ namespace geometry {
     return getMatchingRad(x, y).hasValue();
   }
 
+  // Returns if the given radian, or any of its cycles, is in the circle's radian range
+  bool Circle::hasRad(double rad) {
+    return hasRad(rad, 0);
+  }
+
+  // tolerance - The radians by which the range is extended at both of its ends
+  bool Circle::hasRad(double rad, double tolerance) {
+    double minRad = std::min(_rad1, _rad2) - tolerance;
+    double maxRad = std::max(_rad1, _rad2) + tolerance;
+
+    return maxRad - minRad >= 2 * M_PI ||
+           minRad + utils::mod(rad - minRad, 2 * M_PI) <= maxRad;
+  }
+
+  // Gets the shortest distance between the given point and the circle's arc
+  double Circle::getDistance(double x, double y) {
+    double dx = x - _x;
+    double dy = y - _y;
+
+    // A point which lays in the arc's radian range is as far as its distance from the
+    // circumference. Note that the center is equally far from all of the arc's points
+    if ((!dx && !dy) || hasRad(std::atan2(dy, dx))) {
+      return std::abs(std::hypot(dx, dy) - _r);
+    }
+
+    // Otherwise the closest point of the arc would be one of its ends
+    return std::min(
+      std::hypot(x - (_x + (_r * std::cos(_rad1))), y - (_y + (_r * std::sin(_rad1)))),
+      std::hypot(x - (_x + (_r * std::cos(_rad2))), y - (_y + (_r * std::sin(_rad2))))
+    );
+  }
+
+  // Gets the time it would take a point which moves from (x, y) towards the given radian
+  // with the given velocity to hit the circle's arc, or infinity if it never would.
+  // The time is measured in the velocity's time unit. Contacts within
+  // Line::IMPACT_TOLERANCE are considered hits
+  double Circle::getTimeOfImpact(double x, double y, double rad, double v) {
+    double tolerance = Line::IMPACT_TOLERANCE;
+    double dx = std::cos(rad);
+    double dy = std::sin(rad);
+    double fx = x - _x;
+    double fy = y - _y;
+    double b = 2 * ((dx * fx) + (dy * fy));
+    double c = (fx * fx) + (fy * fy) - (_r * _r);
+    // 4 times the difference between the squared radius and the squared distance of
+    // the movement's line from the center, so a tangent line which misses the circle
+    // by the tolerance would be slightly negative
+    double delta = (b * b) - (4 * c);
+
+    if (v <= 0 || delta < -8 * _r * tolerance) return INFINITY;
+
+    delta = std::max(0.0, delta);
+
+    // Distances along the movement in which it intersects with the circle, the nearer
+    // distance is checked first
+    for (double distance : { (-b - std::sqrt(delta)) / 2, (-b + std::sqrt(delta)) / 2 }) {
+      if (distance < -tolerance) continue;
+
+      double pointRad = std::atan2(fy + (distance * dy), fx + (distance * dx));
+      if (hasRad(pointRad, tolerance / _r)) return std::max(0.0, distance) / v;
+    }
+
+    return INFINITY;
+  }
+
+  // Gets the time it would take a point which moves along another circle to hit the
+  // circle's arc, or infinity if it never would. Contacts within Line::IMPACT_TOLERANCE
+  // are considered hits.
+  // See Line::getArcTimeOfImpact for more information about the arguments
+  double Circle::getArcTimeOfImpact(double x, double y, double r, double rad, double v) {
+    double tolerance = Line::IMPACT_TOLERANCE;
+    double dx = _x - x;
+    double dy = _y - y;
+    double d = std::hypot(dx, dy);
+
+    // Concentric circles never meet, or are always met. Tangent circles meet at a
+    // single point, even if they are apart by the tolerance
+    if (!v || !d || d > r + _r + tolerance || d < std::abs(r - _r) - tolerance)
+      return INFINITY;
+
+    double a = ((r * r) - (_r * _r) + (d * d)) / (2 * d);
+    double h = std::sqrt(std::max(0.0, (r * r) - (a * a)));
+    double time = INFINITY;
+
+    for (double sign : { 1.0, -1.0 }) {
+      double px = x + ((dx * a) / d) - ((sign * dy * h) / d);
+      double py = y + ((dy * a) / d) + ((sign * dx * h) / d);
+
+      if (!hasRad(std::atan2(py - _y, px - _x), tolerance / _r)) continue;
+
+      time = std::min(time, getTravelTime(rad, std::atan2(py - y, px - x), r, v));
+    }
+
+    return time;
+  }
+
+  // Gets the time it takes to travel between 2 radians of a circle with the given
+  // radius and velocity. A positive velocity goes through increasing radians and a
+  // negative velocity goes through decreasing radians
+  double Circle::getTravelTime(double rad1, double rad2, double r, double v) {
+    double rad = v > 0 ?
+      utils::mod(rad2 - rad1, 2 * M_PI) :
+      utils::mod(rad1 - rad2, 2 * M_PI);
+
+    return (rad * r) / std::abs(v);
+  }
+
   // circle - circle intersection method
   Nullable<std::vector<Point>> Circle::getIntersection(Circle circle) {
     double dx = circle._x - _x;
@@ -285,7 +392,11 @@ EMSCRIPTEN_BINDINGS(geometry_circle_module) {
     .property<double>("r", &geometry::Circle::_r)
     .property<double>("rad1", &geometry::Circle::_rad1)
     .property<double>("rad2", &geometry::Circle::_rad2)
-    .function("hasPoint", &geometry::Circle::hasPoint);
+    .function("hasPoint", &geometry::Circle::hasPoint)
+    .function("hasRad", emscripten::select_overload<bool(double)>(&geometry::Circle::hasRad))
+    .function("getDistance", &geometry::Circle::getDistance)
+    .function("getTimeOfImpact", &geometry::Circle::getTimeOfImpact)
+    .function("getArcTimeOfImpact", &geometry::Circle::getArcTimeOfImpact);
 
   emscripten::class_<geometry::EMCircle, emscripten::base<geometry::Circle>>("geometry_circle")
     .constructor<double, double, double, double, double>()
@@ -30,6 +30,18 @@ namespace geometry {
 
     bool hasPoint(double x, double y);
 
+    bool hasRad(double rad);
+
+    bool hasRad(double rad, double tolerance);
+
+    double getDistance(double x, double y);
+
+    double getTimeOfImpact(double x, double y, double rad, double v);
+
+    double getArcTimeOfImpact(double x, double y, double r, double rad, double v);
+
+    static double getTravelTime(double rad1, double rad2, double r, double v);
+
     Nullable<std::vector<Point>> getIntersection(Circle circle);
 
     Nullable<std::vector<Point>> getIntersection(Line line);
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <emscripten/bind.h>
+#include "line.h"
+#include "circle.h"
+#include "distance_field.h"
+
+namespace geometry {
+  // A grid of distances from the nearest shape, sampled at the grid's nodes.
+  // Distances are capped at the max distance, which means that adding a shape
+  // would only affect the nodes in its surrounding, and that lookups are O(1).
+  // width - The width of the covered area
+  // height - The height of the covered area
+  // cellSize - The distance between 2 adjacent nodes
+  // maxDistance - Distances beyond that value are not tracked
+  DistanceField::DistanceField(double width, double height, double cellSize, double maxDistance):
+    _width(width),
+    _height(height),
+    _cellSize(cellSize),
+    _maxDistance(maxDistance),
+    _cols(static_cast<int>(std::ceil(width / cellSize)) + 1),
+    _rows(static_cast<int>(std::ceil(height / cellSize)) + 1) {
+    reset();
+  }
+
+  // Clears all added shapes
+  void DistanceField::reset() {
+    _distances.assign(_cols * _rows, static_cast<float>(_maxDistance));
+  }
+
+  // Lowers the distances of all nodes in the given bounds expanded by the max distance,
+  // the rest of the nodes are too far to be affected by the shape anyways
+  template <typename Shape>
+  void DistanceField::addShape(Shape& shape, double minX, double minY, double maxX, double maxY) {
+    int minCol = std::max(0, static_cast<int>(std::ceil((minX - _maxDistance) / _cellSize)));
+    int minRow = std::max(0, static_cast<int>(std::ceil((minY - _maxDistance) / _cellSize)));
+    int maxCol = std::min(_cols - 1, static_cast<int>(std::floor((maxX + _maxDistance) / _cellSize)));
+    int maxRow = std::min(_rows - 1, static_cast<int>(std::floor((maxY + _maxDistance) / _cellSize)));
+
+    for (int row = minRow; row <= maxRow; row++) {
+      for (int col = minCol; col <= maxCol; col++) {
+        float& distance = _distances.at((row * _cols) + col);
+        double shapeDistance = shape.getDistance(col * _cellSize, row * _cellSize);
+
+        if (shapeDistance < distance) distance = static_cast<float>(shapeDistance);
+      }
+    }
+  }
+
+  void DistanceField::addLine(Line line) {
+    addShape(line,
+      std::min(line._x1, line._x2), std::min(line._y1, line._y2),
+      std::max(line._x1, line._x2), std::max(line._y1, line._y2)
+    );
+  }
+
+  // Only the bounds of the arc itself are used, which are made out of its ends and any
+  // of the circle's axis extremes which the arc passes through, so a short arc of a
+  // big circle would only affect the nodes around it
+  void DistanceField::addCircle(Circle circle) {
+    double minX = std::min(circle._x + (circle._r * std::cos(circle._rad1)),
+                           circle._x + (circle._r * std::cos(circle._rad2)));
+    double minY = std::min(circle._y + (circle._r * std::sin(circle._rad1)),
+                           circle._y + (circle._r * std::sin(circle._rad2)));
+    double maxX = std::max(circle._x + (circle._r * std::cos(circle._rad1)),
+                           circle._x + (circle._r * std::cos(circle._rad2)));
+    double maxY = std::max(circle._y + (circle._r * std::sin(circle._rad1)),
+                           circle._y + (circle._r * std::sin(circle._rad2)));
+
+    if (circle.hasRad(0)) maxX = circle._x + circle._r;
+    if (circle.hasRad(0.5 * M_PI)) maxY = circle._y + circle._r;
+    if (circle.hasRad(M_PI)) minX = circle._x - circle._r;
+    if (circle.hasRad(1.5 * M_PI)) minY = circle._y - circle._r;
+
+    addShape(circle, minX, minY, maxX, maxY);
+  }
+
+  // Gets the distance of the node nearest to the given point
+  double DistanceField::getDistance(double x, double y) {
+    int col = static_cast<int>(std::round(x / _cellSize));
+    int row = static_cast<int>(std::round(y / _cellSize));
+    col = std::max(0, std::min(_cols - 1, col));
+    row = std::max(0, std::min(_rows - 1, row));
+
+    return _distances.at((row * _cols) + col);
+  }
+
+  // Gets the distance at the given point, bilinearly interpolated from the 4 nodes
+  // surrounding it
+  double DistanceField::sample(double x, double y) {
+    double col = std::max(0.0, std::min(_cols - 1.0, x / _cellSize));
+    double row = std::max(0.0, std::min(_rows - 1.0, y / _cellSize));
+    int col1 = std::min(_cols - 2, static_cast<int>(col));
+    int row1 = std::min(_rows - 2, static_cast<int>(row));
+    int col2 = std::min(_cols - 1, col1 + 1);
+    int row2 = std::min(_rows - 1, row1 + 1);
+    double tx = col - col1;
+    double ty = row - row1;
+
+    double top = (_distances.at((row1 * _cols) + col1) * (1 - tx)) +
+                 (_distances.at((row1 * _cols) + col2) * tx);
+    double bottom = (_distances.at((row2 * _cols) + col1) * (1 - tx)) +
+                    (_distances.at((row2 * _cols) + col2) * tx);
+
+    return (top * (1 - ty)) + (bottom * ty);
+  }
+}
+
+EMSCRIPTEN_BINDINGS(geometry_distance_field_module) {
+  emscripten::class_<geometry::DistanceField>("geometry_distance_field")
+    .constructor<double, double, double, double>()
+    .property<double>("width", &geometry::DistanceField::_width)
+    .property<double>("height", &geometry::DistanceField::_height)
+    .property<double>("cellSize", &geometry::DistanceField::_cellSize)
+    .property<double>("maxDistance", &geometry::DistanceField::_maxDistance)
+    .function("reset", &geometry::DistanceField::reset)
+    .function("addLine", &geometry::DistanceField::addLine)
+    .function("addCircle", &geometry::DistanceField::addCircle)
+    .function("getDistance", &geometry::DistanceField::getDistance)
+    .function("sample", &geometry::DistanceField::sample);
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <vector>
+#include "line.h"
+#include "circle.h"
+
+namespace geometry {
+  class DistanceField {
+  private:
+    template <typename Shape>
+    void addShape(Shape& shape, double minX, double minY, double maxX, double maxY);
+
+  public:
+    double _width;
+    double _height;
+    double _cellSize;
+    double _maxDistance;
+    int _cols;
+    int _rows;
+    std::vector<float> _distances;
+
+    DistanceField(double width, double height, double cellSize, double maxDistance);
+
+    void reset();
+
+    void addLine(Line line);
+
+    void addCircle(Circle circle);
+
+    double getDistance(double x, double y);
+
+    double sample(double x, double y);
+  };
+}
\ No newline at end of file
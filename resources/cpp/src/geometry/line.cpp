@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
 #include <vector>
 #include <emscripten/bind.h>
 #include <emscripten/val.h>
@@ -53,15 +56,72 @@ namespace geometry {
     return Nullable<double>();
   }
 
+  // Gets the side of the directed line (x1, y1) -> (x2, y2) on which the given point
+  // lies: 1 for left (counter-clockwise), -1 for right (clockwise) and 0 if the three
+  // points are collinear. A plain floating point evaluation is used whenever its error
+  // bound can guarantee the sign, which is the case for the vast majority of points.
+  // squaredTolerance - Points whose squared determinant is within it are considered
+  // collinear, see getSquaredTolerance. Defaults to 0, in which case collinearity is exact
+  int Line::getOrientation(double x1, double y1, double x2, double y2, double x, double y,
+                           double squaredTolerance) {
+    double left = (x1 - x) * (y2 - y);
+    double right = (y1 - y) * (x2 - x);
+    double determinant = left - right;
+
+    if (squaredTolerance && determinant * determinant <= squaredTolerance) return 0;
+
+    // See Shewchuk's "Adaptive Precision Floating-Point Arithmetic and Fast Robust
+    // Geometric Predicates", where ε is half of the machine epsilon
+    double bound = (3 + (8 * DBL_EPSILON)) * (DBL_EPSILON / 2) *
+      (std::abs(left) + std::abs(right));
+
+    if (determinant > bound) return 1;
+    if (-determinant > bound) return -1;
+
+    return getExactOrientation(x1, y1, x2, y2, x, y);
+  }
+
+  // Same as getOrientation, only the determinant is evaluated exactly. Each of its
+  // products is split into a pair of non-overlapping doubles which are then summed up
+  // into an expansion, whose most significant component carries the sign
+  int Line::getExactOrientation(double x1, double y1, double x2, double y2, double x, double y) {
+    double factors[6][2] = {
+      { x1, y2 }, { -y1, x2 }, { x2, y }, { -y2, x }, { x, y1 }, { -y, x1 }
+    };
+    double expansion[13];
+    int length = 0;
+
+    for (int i = 0; i < 6; i++) {
+      double product = factors[i][0] * factors[i][1];
+      double error = std::fma(factors[i][0], factors[i][1], -product);
+
+      for (double term : { error, product }) {
+        // Grow the expansion by a single term, carrying the sum along the way
+        for (int j = 0; j < length; j++) {
+          double sum = term + expansion[j];
+          double virtualTerm = sum - expansion[j];
+          double virtualComponent = sum - virtualTerm;
+          expansion[j] = (term - virtualTerm) + (expansion[j] - virtualComponent);
+          term = sum;
+        }
+
+        expansion[length++] = term;
+      }
+    }
+
+    for (int i = length - 1; i >= 0; i--) {
+      if (expansion[i] > 0) return 1;
+      if (expansion[i] < 0) return -1;
+    }
+
+    return 0;
+  }
+
   // Returns if line has given point
   bool Line::hasPoint(double x, double y) {
-    if (!boundsHavePoint(x, y)) return 0;
+    if (!boundsHavePoint(x, y)) return false;
 
-    double m = utils::trim(
-      (_y2 - _y1) / (_x2 - _x1),
-    9, "exact");
-
-    return (y - _y1) / (x - _x1) == m;
+    return !getOrientation(_x1, _y1, _x2, _y2, x, y, getSquaredTolerance());
   }
 
   // Returns if given point is contained by the bounds aka cage of line
@@ -70,35 +130,144 @@ namespace geometry {
            utils::isBetween(y, _y1, _y2, "round");
   }
 
+  // Gets the squared orientation tolerance of the line. The determinant of a point
+  // equals its distance from the line times the line's length, so points which are less
+  // than 1e-9 away from the line, i.e. the precision values are trimmed to, are
+  // considered on it. Otherwise points like (x, getY(x)) would be missed. Squared, so
+  // no square root is taken for the vast majority of points which are nowhere near
+  double Line::getSquaredTolerance() {
+    double dx = _x2 - _x1;
+    double dy = _y2 - _y1;
+
+    return ((dx * dx) + (dy * dy)) * 1e-18;
+  }
+
+  // Gets the shortest distance between the given point and the line segment
+  double Line::getDistance(double x, double y) {
+    double dx = _x2 - _x1;
+    double dy = _y2 - _y1;
+    double lengthSquared = (dx * dx) + (dy * dy);
+
+    // Project the point onto the line and clamp the projection to the segment's
+    // ends. A line with no length degenerates into its first point
+    double t = 0;
+
+    if (lengthSquared > 0) {
+      t = (((x - _x1) * dx) + ((y - _y1) * dy)) / lengthSquared;
+      t = std::max(0.0, std::min(1.0, t));
+    }
+
+    return std::hypot(x - (_x1 + (t * dx)), y - (_y1 + (t * dy)));
+  }
+
+  // Gets the time it would take a point which moves from (x, y) towards the given radian
+  // with the given velocity to hit the line, or infinity if it never would. The time
+  // is measured in the velocity's time unit. Contacts within IMPACT_TOLERANCE of the
+  // line's ends, or behind the point, are considered hits
+  double Line::getTimeOfImpact(double x, double y, double rad, double v) {
+    double dx = std::cos(rad);
+    double dy = std::sin(rad);
+    double ex = _x2 - _x1;
+    double ey = _y2 - _y1;
+    double wx = _x1 - x;
+    double wy = _y1 - y;
+    double denominator = (dx * ey) - (dy * ex);
+
+    // Parallel lines never meet
+    if (v <= 0 || !denominator) return INFINITY;
+
+    // Distance along the movement, and the relative position along the line
+    double distance = ((wx * ey) - (wy * ex)) / denominator;
+    double t = ((wx * dy) - (wy * dx)) / denominator;
+    double tolerance = IMPACT_TOLERANCE / std::hypot(ex, ey);
+
+    if (distance < -IMPACT_TOLERANCE || t < -tolerance || t > 1 + tolerance) return INFINITY;
+
+    return std::max(0.0, distance) / v;
+  }
+
+  // Gets the time it would take a point which moves along a circle to hit the line,
+  // or infinity if it never would. Contacts within IMPACT_TOLERANCE are considered hits,
+  // e.g. a circle which grazes one of the line's ends.
+  // x - The x value of the circle's center
+  // y - The y value of the circle's center
+  // r - The radius of the circle
+  // rad - The current radian of the point
+  // v - The velocity of the point, positive for increasing radians and negative
+  // for decreasing radians
+  double Line::getArcTimeOfImpact(double x, double y, double r, double rad, double v) {
+    double ex = _x2 - _x1;
+    double ey = _y2 - _y1;
+    double fx = _x1 - x;
+    double fy = _y1 - y;
+    double a = (ex * ex) + (ey * ey);
+    double b = 2 * ((ex * fx) + (ey * fy));
+    double c = (fx * fx) + (fy * fy) - (r * r);
+    // 4a times the difference between the squared radius and the squared distance of
+    // the line from the center, see Circle::getTimeOfImpact
+    double delta = (b * b) - (4 * a * c);
+
+    if (!v || !a || delta < -8 * a * r * IMPACT_TOLERANCE) return INFINITY;
+
+    double tolerance = IMPACT_TOLERANCE / std::sqrt(a);
+    double time = INFINITY;
+    delta = std::max(0.0, delta);
+
+    // Relative positions along the line in which it intersects with the circle. A
+    // position which grazes one of the ends is snapped onto it
+    for (double t : { (-b - std::sqrt(delta)) / (2 * a), (-b + std::sqrt(delta)) / (2 * a) }) {
+      if (t < -tolerance || t > 1 + tolerance) continue;
+
+      t = std::max(0.0, std::min(1.0, t));
+      double pointRad = std::atan2(fy + (t * ey), fx + (t * ex));
+      time = std::min(time, Circle::getTravelTime(rad, pointRad, r, v));
+    }
+
+    return time;
+  }
+
   // line - line intersection method
   Nullable<Point> Line::getIntersection(Line line) {
-    // Escape if lines are parallel
-    if (!(((_x1 - _x2) * (line._y1 - line._y2)) -
-          ((_y1 - _y2) * (line._x1 - line._x2))))
+    // Escape if this line is entirely on one side of the given line, or vice versa.
+    // Ends which were trimmed onto the other line are considered on it
+    double tolerance = line.getSquaredTolerance();
+    int orientation1 = getOrientation(line._x1, line._y1, line._x2, line._y2, _x1, _y1, tolerance);
+    int orientation2 = getOrientation(line._x1, line._y1, line._x2, line._y2, _x2, _y2, tolerance);
+    if (orientation1 * orientation2 > 0) return Nullable<Point>();
+
+    tolerance = getSquaredTolerance();
+    int orientation3 = getOrientation(_x1, _y1, _x2, _y2, line._x1, line._y1, tolerance);
+    int orientation4 = getOrientation(_x1, _y1, _x2, _y2, line._x2, line._y2, tolerance);
+    if (orientation3 * orientation4 > 0) return Nullable<Point>();
+
+    // Escape if lines are collinear or one of them is a single point, in which case
+    // there is no single intersection point
+    if ((!orientation1 && !orientation2) || (!orientation3 && !orientation4))
       return Nullable<Point>();
 
-    // Intersection point formula
-    double x = utils::trim(
-      ((((_x1 * _y2) - (_y1 * _x2)) * (line._x1 - line._x2)) -
-       ((_x1 - _x2) * ((line._x1 * line._y2) - (line._y1 * line._x2)))) /
-      (((_x1 - _x2) * (line._y1 - line._y2)) - ((_y1 - _y2) *
-        (line._x1 - line._x2)))
-    , 9, "exact");
-    double y = utils::trim(
-      ((((_x1 * _y2) - (_y1 * _x2)) * (line._y1 - line._y2)) -
-       ((_y1 - _y2) * ((line._x1 * line._y2) - (line._y1 * line._x2)))) /
-      (((_x1 - _x2) * (line._y1 - line._y2)) - ((_y1 - _y2) *
-        (line._x1 - line._x2)))
-    , 9, "exact");
+    double x;
+    double y;
+
+    // An end which lies on the other line is the intersection point itself
+    if (!orientation1) { x = _x1; y = _y1; }
+    else if (!orientation2) { x = _x2; y = _y2; }
+    else if (!orientation3) { x = line._x1; y = line._y1; }
+    else if (!orientation4) { x = line._x2; y = line._y2; }
+    else {
+      double dx = _x2 - _x1;
+      double dy = _y2 - _y1;
+      double ex = line._x2 - line._x1;
+      double ey = line._y2 - line._y1;
+      // Relative position of the intersection point along this line
+      double t = (((line._x1 - _x1) * ey) - ((line._y1 - _y1) * ex)) /
+        ((dx * ey) - (dy * ex));
+      t = std::max(0.0, std::min(1.0, t));
 
-    if (utils::isBetween(x, _x1, _x2, "round") &&
-        utils::isBetween(x, line._x1, line._x2, "round") &&
-        utils::isBetween(y, _y1, _y2, "round") &&
-        utils::isBetween(y, line._y1, line._y2, "round")) {
-      return Nullable<Point>({ x, y });
+      x = _x1 + (t * dx);
+      y = _y1 + (t * dy);
     }
 
-    return Nullable<Point>();
+    return Nullable<Point>({ utils::trim(x, 9, "exact"), utils::trim(y, 9, "exact") });
   }
 
   // circle - circle intersection method
@@ -146,7 +315,10 @@ EMSCRIPTEN_BINDINGS(geometry_line_module) {
     .property<double>("x2", &geometry::Line::_x2)
     .property<double>("y2", &geometry::Line::_y2)
     .function("hasPoint", &geometry::Line::hasPoint)
-    .function("boundsHavePoint", &geometry::Line::boundsHavePoint);
+    .function("boundsHavePoint", &geometry::Line::boundsHavePoint)
+    .function("getDistance", &geometry::Line::getDistance)
+    .function("getTimeOfImpact", &geometry::Line::getTimeOfImpact)
+    .function("getArcTimeOfImpact", &geometry::Line::getArcTimeOfImpact);
 
   emscripten::class_<geometry::EMLine, emscripten::base<geometry::Line>>("geometry_line")
     .constructor<double, double, double, double>()
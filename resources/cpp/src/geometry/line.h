@@ -12,6 +12,11 @@ namespace geometry {
 
   class Line {
   public:
+    // The distance in pixels within which shapes are considered touching when their
+    // time of impact is calculated, so grazing contacts which the intersection methods
+    // detect despite precision errors would not be missed
+    static constexpr double IMPACT_TOLERANCE = 1e-6;
+
     double _x1;
     double _y1;
     double _x2;
@@ -19,6 +24,11 @@ namespace geometry {
 
     Line(double x1, double y1, double x2, double y2);
 
+    static int getOrientation(double x1, double y1, double x2, double y2, double x, double y,
+                              double squaredTolerance = 0);
+
+    static int getExactOrientation(double x1, double y1, double x2, double y2, double x, double y);
+
     Nullable<double> getMatchingX(double y);
 
     Nullable<double> getMatchingY(double x);
@@ -27,6 +37,14 @@ namespace geometry {
 
     bool boundsHavePoint(double x, double y);
 
+    double getSquaredTolerance();
+
+    double getDistance(double x, double y);
+
+    double getTimeOfImpact(double x, double y, double rad, double v);
+
+    double getArcTimeOfImpact(double x, double y, double r, double rad, double v);
+
     Nullable<Point> getIntersection(Line line);
 
     Nullable<std::vector<Point>> getIntersection(Circle circle);
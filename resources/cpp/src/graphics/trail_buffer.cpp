@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <emscripten/bind.h>
+#include <emscripten/val.h>
+#include "../geometry/line.h"
+#include "../geometry/circle.h"
+#include "trail_buffer.h"
+
+namespace graphics {
+  // A vertex buffer of line segments, each made out of 2 vertices of x and y, which
+  // represents a tessellated trail. The trail's last shape is the only one which is
+  // still growing, therefore it is the only one which is re-tessellated on update.
+  // tolerance - The max distance between a tessellated arc and the real arc, in pixels
+  TrailBuffer::TrailBuffer(double tolerance): _committedSize(0), _tolerance(tolerance) {
+  }
+
+  void TrailBuffer::appendSegment(double x1, double y1, double x2, double y2) {
+    _vertices.push_back(static_cast<float>(x1));
+    _vertices.push_back(static_cast<float>(y1));
+    _vertices.push_back(static_cast<float>(x2));
+    _vertices.push_back(static_cast<float>(y2));
+  }
+
+  void TrailBuffer::appendLine(geometry::Line& line) {
+    appendSegment(line._x1, line._y1, line._x2, line._y2);
+  }
+
+  // The number of segments is based on the arc's radius and sweep, so each segment
+  // would deviate from the arc by no more than the tolerance
+  void TrailBuffer::appendCircle(geometry::Circle& circle) {
+    double rad1 = std::min(circle._rad1, circle._rad2);
+    double rad2 = std::max(circle._rad1, circle._rad2);
+    double maxStep = _tolerance < circle._r ?
+      2 * std::acos(1 - (_tolerance / circle._r)) :
+      M_PI;
+    int count = std::max(1, static_cast<int>(std::ceil((rad2 - rad1) / maxStep)));
+    double step = (rad2 - rad1) / count;
+
+    double x = circle._x + (circle._r * std::cos(rad1));
+    double y = circle._y + (circle._r * std::sin(rad1));
+
+    for (int i = 1; i <= count; i++) {
+      double rad = i == count ? rad2 : rad1 + (i * step);
+      double nextX = circle._x + (circle._r * std::cos(rad));
+      double nextY = circle._y + (circle._r * std::sin(rad));
+
+      appendSegment(x, y, nextX, nextY);
+      x = nextX;
+      y = nextY;
+    }
+  }
+
+  // Fixates the current shape and starts a new one with the given line
+  void TrailBuffer::pushLine(geometry::Line line) {
+    _committedSize = _vertices.size();
+    appendLine(line);
+  }
+
+  // Fixates the current shape and starts a new one with the given circle
+  void TrailBuffer::pushCircle(geometry::Circle circle) {
+    _committedSize = _vertices.size();
+    appendCircle(circle);
+  }
+
+  // Re-tessellates the current shape
+  void TrailBuffer::updateLine(geometry::Line line) {
+    _vertices.resize(_committedSize);
+    appendLine(line);
+  }
+
+  // Re-tessellates the current shape
+  void TrailBuffer::updateCircle(geometry::Circle circle) {
+    _vertices.resize(_committedSize);
+    appendCircle(circle);
+  }
+
+  void TrailBuffer::clear() {
+    _vertices.clear();
+    _committedSize = 0;
+  }
+
+  unsigned TrailBuffer::getVertexCount() {
+    return _vertices.size() / 2;
+  }
+
+  // Returns a Float32Array view over the buffer's memory. The view is invalidated
+  // once the buffer grows, so it should be re-fetched before each usage
+  emscripten::val TrailBuffer::getVertices() {
+    return emscripten::val(
+      emscripten::typed_memory_view(_vertices.size(), _vertices.data())
+    );
+  }
+}
+
+EMSCRIPTEN_BINDINGS(graphics_trail_buffer_module) {
+  emscripten::class_<graphics::TrailBuffer>("graphics_trail_buffer")
+    .constructor<double>()
+    .property<double>("tolerance", &graphics::TrailBuffer::_tolerance)
+    .function("pushLine", &graphics::TrailBuffer::pushLine)
+    .function("pushCircle", &graphics::TrailBuffer::pushCircle)
+    .function("updateLine", &graphics::TrailBuffer::updateLine)
+    .function("updateCircle", &graphics::TrailBuffer::updateCircle)
+    .function("clear", &graphics::TrailBuffer::clear)
+    .function("getVertexCount", &graphics::TrailBuffer::getVertexCount)
+    .function("getVertices", &graphics::TrailBuffer::getVertices);
+}
\ No newline at end of file
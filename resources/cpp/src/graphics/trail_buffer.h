@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+#include <emscripten/val.h>
+#include "../geometry/line.h"
+#include "../geometry/circle.h"
+
+namespace graphics {
+  class TrailBuffer {
+  private:
+    std::vector<float> _vertices;
+    unsigned _committedSize;
+
+    void appendSegment(double x1, double y1, double x2, double y2);
+
+    void appendLine(geometry::Line& line);
+
+    void appendCircle(geometry::Circle& circle);
+
+  public:
+    double _tolerance;
+
+    TrailBuffer(double tolerance);
+
+    void pushLine(geometry::Line line);
+
+    void pushCircle(geometry::Circle circle);
+
+    void updateLine(geometry::Line line);
+
+    void updateCircle(geometry::Circle circle);
+
+    void clear();
+
+    unsigned getVertexCount();
+
+    emscripten::val getVertices();
+  };
+}
\ No newline at end of file
@@ -1,4 +1,12 @@
 #include "nullable.cpp"
 #include "utils.cpp"
 #include "geometry/line.cpp"
-#include "geometry/circle.cpp"
\ No newline at end of file
+#include "geometry/circle.cpp"
+#include "geometry/distance_field.cpp"
+#include "graphics/trail_buffer.cpp"
+#include "simulation/shape.cpp"
+#include "simulation/trail.cpp"
+#include "simulation/occupancy_bitmap.cpp"
+#include "simulation/world.cpp"
+#include "simulation/world_view.cpp"
+#include "simulation/pipeline.cpp"
\ No newline at end of file
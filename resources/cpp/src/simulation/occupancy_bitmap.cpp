@@ -0,0 +1,191 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "shape.h"
+#include "occupancy_bitmap.h"
+
+namespace simulation {
+  // generation - The generation of the bitmap which creates the tile
+  OccupancyTile::OccupancyTile(uint64_t generation): _generation(generation) {
+    std::fill(_bits, _bits + SIZE, 0);
+  }
+
+  OccupancyBitmap::OccupancyBitmap():
+    _generation(createGeneration()),
+    _width(0),
+    _height(0),
+    _margin(0),
+    _cols(0),
+    _rows(0) {
+  }
+
+  // A packed bitmap of the pixels occupied by trails, in which each pixel also knows
+  // which snake occupied it and when. The bitmap is divided into tiles which are only
+  // allocated once written to, and are shared between copies of the bitmap until one
+  // of the copies writes to them, so copying a bitmap is O(tiles).
+  // width - The width of the bitmap in pixels
+  // height - The height of the bitmap in pixels
+  // margin - The number of pixels beyond each of the bitmap's edges which are tracked
+  // as well, e.g. for shapes which slightly exceed the bitmap's bounds
+  OccupancyBitmap::OccupancyBitmap(int width, int height, int margin):
+    _generation(createGeneration()),
+    _width(width),
+    _height(height),
+    _margin(margin),
+    _cols((width + (2 * margin) + OccupancyTile::SIZE - 1) / OccupancyTile::SIZE),
+    _rows((height + (2 * margin) + OccupancyTile::SIZE - 1) / OccupancyTile::SIZE),
+    _tiles(_cols * _rows) {
+  }
+
+  // Both bitmaps start a new generation, so neither of them would write to the tiles
+  // which are shared from now on. Tiles are written in place only by the generation
+  // which created them, which means that a tile is never written while it is shared,
+  // even if the other bitmap lives on another thread, e.g. see Pipeline
+  OccupancyBitmap::OccupancyBitmap(const OccupancyBitmap& bitmap):
+    _generation(createGeneration()),
+    _width(bitmap._width),
+    _height(bitmap._height),
+    _margin(bitmap._margin),
+    _cols(bitmap._cols),
+    _rows(bitmap._rows),
+    _tiles(bitmap._tiles) {
+    bitmap._generation = createGeneration();
+  }
+
+  OccupancyBitmap& OccupancyBitmap::operator=(const OccupancyBitmap& bitmap) {
+    _generation = createGeneration();
+    _width = bitmap._width;
+    _height = bitmap._height;
+    _margin = bitmap._margin;
+    _cols = bitmap._cols;
+    _rows = bitmap._rows;
+    _tiles = bitmap._tiles;
+    bitmap._generation = createGeneration();
+    return *this;
+  }
+
+  uint64_t OccupancyBitmap::createGeneration() {
+    static std::atomic<uint64_t> generationsCount(0);
+    return ++generationsCount;
+  }
+
+  const OccupancyTile* OccupancyBitmap::getTile(int x, int y) const {
+    return _tiles.at(((y / OccupancyTile::SIZE) * _cols) + (x / OccupancyTile::SIZE)).get();
+  }
+
+  bool OccupancyBitmap::isOccupied(Pixel pixel) const {
+    const OccupancyTile* tile = getTile(pixel.x, pixel.y);
+    if (!tile) return false;
+
+    uint64_t row = tile->_bits[pixel.y % OccupancyTile::SIZE];
+    return (row >> (pixel.x % OccupancyTile::SIZE)) & 1;
+  }
+
+  unsigned OccupancyBitmap::getOwner(Pixel pixel) const {
+    const OccupancyTile* tile = getTile(pixel.x, pixel.y);
+    int index = ((pixel.y % OccupancyTile::SIZE) * OccupancyTile::SIZE) +
+                (pixel.x % OccupancyTile::SIZE);
+
+    return tile->_records[index] >> 24;
+  }
+
+  unsigned OccupancyBitmap::getSequence(Pixel pixel) const {
+    const OccupancyTile* tile = getTile(pixel.x, pixel.y);
+    int index = ((pixel.y % OccupancyTile::SIZE) * OccupancyTile::SIZE) +
+                (pixel.x % OccupancyTile::SIZE);
+
+    return tile->_records[index] & 0xffffff;
+  }
+
+  // owner - The index of the occupying snake, up to 255
+  // sequence - The number of pixels the owner has occupied so far, up to 2^24
+  void OccupancyBitmap::occupy(Pixel pixel, unsigned owner, unsigned sequence) {
+    std::shared_ptr<OccupancyTile>& tile =
+      _tiles.at(((pixel.y / OccupancyTile::SIZE) * _cols) + (pixel.x / OccupancyTile::SIZE));
+
+    // Copy on write, the tile might be shared with a snapshot
+    if (!tile)
+      tile = std::make_shared<OccupancyTile>(_generation);
+    else if (tile->_generation != _generation) {
+      tile = std::make_shared<OccupancyTile>(*tile);
+      tile->_generation = _generation;
+    }
+
+    int x = pixel.x % OccupancyTile::SIZE;
+    int y = pixel.y % OccupancyTile::SIZE;
+    tile->_bits[y] |= uint64_t(1) << x;
+    tile->_records[(y * OccupancyTile::SIZE) + x] = (owner << 24) | (sequence & 0xffffff);
+  }
+
+  // Appends the pixels covered by the given shape, in order. Pixels are offset by the
+  // margin, and parts of the shape which exceed the margin are ignored. Diagonal steps
+  // are broken into 2 steps through the pixel which the path actually passes through,
+  // so that 2 crossing or touching shapes would always share a pixel
+  void OccupancyBitmap::rasterize(const Shape& shape, std::vector<Pixel>& pixels) const {
+    double length = shape.type == LINE ?
+      std::hypot(shape.x2 - shape.x1, shape.y2 - shape.y1) :
+      shape.r * std::abs(shape.rad2 - shape.rad1);
+    // Sample twice per pixel, so consecutive samples are at most 1 pixel apart
+    int count = std::max(1, static_cast<int>(std::ceil(length * 2)));
+    bool continuous = false;
+    double lastX = 0;
+    double lastY = 0;
+
+    for (int i = 0; i <= count; i++) {
+      double t = static_cast<double>(i) / count;
+      double x;
+      double y;
+
+      if (shape.type == LINE) {
+        x = shape.x1 + ((shape.x2 - shape.x1) * t);
+        y = shape.y1 + ((shape.y2 - shape.y1) * t);
+      }
+      else {
+        double rad = shape.rad1 + ((shape.rad2 - shape.rad1) * t);
+        x = shape.x + (shape.r * std::cos(rad));
+        y = shape.y + (shape.r * std::sin(rad));
+      }
+
+      Pixel pixel = {
+        static_cast<int>(std::floor(x)) + _margin,
+        static_cast<int>(std::floor(y)) + _margin
+      };
+
+      if (pixel.x < 0 || pixel.x >= _width + (2 * _margin) ||
+          pixel.y < 0 || pixel.y >= _height + (2 * _margin)) {
+        continuous = false;
+        continue;
+      }
+
+      if (continuous) {
+        Pixel last = pixels.back();
+
+        if (last.x == pixel.x && last.y == pixel.y) {
+          lastX = x;
+          lastY = y;
+          continue;
+        }
+
+        if (last.x != pixel.x && last.y != pixel.y) {
+          // Relative positions along the step in which the pixels' column boundary and
+          // row boundary are crossed, whichever comes first is the pixel passed through
+          double tx = (std::max(last.x, pixel.x) - _margin - lastX) / (x - lastX);
+          double ty = (std::max(last.y, pixel.y) - _margin - lastY) / (y - lastY);
+
+          if (tx < ty)
+            pixels.push_back({ pixel.x, last.y });
+          else
+            pixels.push_back({ last.x, pixel.y });
+        }
+      }
+
+      pixels.push_back(pixel);
+      continuous = true;
+      lastX = x;
+      lastY = y;
+    }
+  }
+}
\ No newline at end of file
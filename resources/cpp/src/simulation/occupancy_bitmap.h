@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "shape.h"
+
+namespace simulation {
+  struct Pixel {
+    int x;
+    int y;
+  };
+
+  class OccupancyTile {
+  public:
+    static const int SIZE = 64;
+
+    // A row of occupancy bits per tile row
+    uint64_t _bits[SIZE];
+    // The owner and the sequence number of each occupied pixel
+    uint32_t _records[SIZE * SIZE];
+    // The generation of the bitmap which created the tile
+    uint64_t _generation;
+
+    OccupancyTile(uint64_t generation);
+  };
+
+  class OccupancyBitmap {
+  private:
+    // Tiles of other generations might be shared with other bitmaps. Mutable since
+    // copying a bitmap renews the generation of the copied bitmap as well
+    mutable uint64_t _generation;
+
+    static uint64_t createGeneration();
+
+    const OccupancyTile* getTile(int x, int y) const;
+
+  public:
+    int _width;
+    int _height;
+    int _margin;
+    int _cols;
+    int _rows;
+    std::vector<std::shared_ptr<OccupancyTile>> _tiles;
+
+    OccupancyBitmap();
+
+    OccupancyBitmap(int width, int height, int margin = 0);
+
+    OccupancyBitmap(const OccupancyBitmap& bitmap);
+
+    OccupancyBitmap& operator=(const OccupancyBitmap& bitmap);
+
+    bool isOccupied(Pixel pixel) const;
+
+    unsigned getOwner(Pixel pixel) const;
+
+    unsigned getSequence(Pixel pixel) const;
+
+    void occupy(Pixel pixel, unsigned owner, unsigned sequence);
+
+    void rasterize(const Shape& shape, std::vector<Pixel>& pixels) const;
+  };
+}
\ No newline at end of file
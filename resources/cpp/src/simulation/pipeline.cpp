@@ -0,0 +1,149 @@
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include <emscripten/bind.h>
+#include "world.h"
+#include "world_view.h"
+#include "pipeline.h"
+
+namespace simulation {
+  // Simulates the next tick of the world while the current one is being rendered.
+  // The results are double buffered: the front world is the recent collected tick,
+  // which is viewed for rendering, and the back world is written by the worker.
+  // A frame is expected to look like so:
+  //
+  //   pipeline.collect();
+  //   pipeline.setDirection(...);
+  //   pipeline.submit(span);
+  //   render(pipeline.getFront());
+  //
+  // Inputs are captured once a tick is submitted, so the results are identical to
+  // the results of stepping the world directly.
+  // world - The initial state of the world, which is copied
+  Pipeline::Pipeline(const World& world):
+    _world(world),
+    _back(world),
+    _front(world),
+    _inputs(world.getSnakesCount()),
+    _pendingSpan(0),
+    _pending(false),
+    _done(false),
+    _stopped(false) {
+    // Directions which were already set on the world carry on to the next ticks
+    for (unsigned i = 0; i < world.getSnakesCount(); i++) {
+      Direction input = world._snakes.at(i).input;
+      _inputs.at(i) = input == LEFT ? "left" : input == RIGHT ? "right" : "";
+    }
+
+#ifdef SIMULATION_THREADS
+    _thread = std::thread(&Pipeline::run, this);
+#endif
+  }
+
+  Pipeline::~Pipeline() {
+#ifdef SIMULATION_THREADS
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stopped = true;
+    }
+
+    _condition.notify_all();
+    _thread.join();
+#endif
+  }
+
+#ifdef SIMULATION_THREADS
+  // Waits for submitted ticks and simulates them
+  void Pipeline::run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    while (true) {
+      _condition.wait(lock, [this] { return _stopped || (_pending && !_done); });
+      if (_stopped) return;
+
+      std::vector<std::string> inputs = _pendingInputs;
+      double span = _pendingSpan;
+
+      lock.unlock();
+      simulate(inputs, span);
+      lock.lock();
+
+      _done = true;
+      _condition.notify_all();
+    }
+  }
+#endif
+
+  // Steps the world and publishes the result to the back buffer. Thanks to the
+  // world's persistent trails, publishing is O(snakes)
+  void Pipeline::simulate(const std::vector<std::string>& inputs, double span) {
+    for (unsigned i = 0; i < inputs.size(); i++) {
+      _world.setDirection(i, inputs.at(i));
+    }
+
+    _world.step(span);
+    _back = _world;
+  }
+
+  // Sets the direction of the snake for the next submitted ticks.
+  // See World::setDirection for more information
+  void Pipeline::setDirection(unsigned index, const std::string direction) {
+    _inputs.at(index) = direction;
+  }
+
+  // Starts simulating the next tick based on the elapsed time in ms. Only a single
+  // tick can be pending, so a pending tick would be collected first
+  void Pipeline::submit(double span) {
+    collect();
+
+#ifdef SIMULATION_THREADS
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _pendingInputs = _inputs;
+      _pendingSpan = span;
+      _pending = true;
+      _done = false;
+    }
+
+    _condition.notify_all();
+#else
+    simulate(_inputs, span);
+    _pending = true;
+    _done = true;
+#endif
+  }
+
+  // Waits for the pending tick and swaps it into the front buffer. Returns false
+  // if there was no pending tick
+  bool Pipeline::collect() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (!_pending) return false;
+
+    _condition.wait(lock, [this] { return _done; });
+    std::swap(_front, _back);
+    _pending = false;
+    return true;
+  }
+
+  // Returns a read-only view of the recent collected tick. A copy of the world would
+  // share trails with the worker's world
+  WorldView Pipeline::getFront() const {
+    return WorldView(_front);
+  }
+
+  unsigned Pipeline::getTick() const {
+    return _front._tick;
+  }
+}
+
+EMSCRIPTEN_BINDINGS(simulation_pipeline_module) {
+  emscripten::class_<simulation::Pipeline>("simulation_pipeline")
+    .constructor<const simulation::World&>()
+    .function("setDirection", &simulation::Pipeline::setDirection)
+    .function("submit", &simulation::Pipeline::submit)
+    .function("collect", &simulation::Pipeline::collect)
+    .function("getFront", &simulation::Pipeline::getFront)
+    .function("getTick", &simulation::Pipeline::getTick);
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "world.h"
+#include "world_view.h"
+
+// Ticks are simulated by a worker thread natively, or when Emscripten compiles with
+// pthreads support (npm run build:cpp:threads, which replaces the regular bundle and
+// requires the cross-origin isolation headers sent by server.js). Otherwise ticks are
+// simulated synchronously once submitted
+#if !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__)
+#define SIMULATION_THREADS
+#include <thread>
+#endif
+
+namespace simulation {
+  class Pipeline {
+  private:
+    // Owned by the worker while a tick is pending
+    World _world;
+    World _back;
+    World _front;
+    std::vector<std::string> _inputs;
+    std::vector<std::string> _pendingInputs;
+    double _pendingSpan;
+    bool _pending;
+    bool _done;
+    bool _stopped;
+    std::mutex _mutex;
+    std::condition_variable _condition;
+#ifdef SIMULATION_THREADS
+    std::thread _thread;
+
+    void run();
+#endif
+
+    void simulate(const std::vector<std::string>& inputs, double span);
+
+  public:
+    Pipeline(const World& world);
+
+    ~Pipeline();
+
+    void setDirection(unsigned index, const std::string direction);
+
+    void submit(double span);
+
+    bool collect();
+
+    WorldView getFront() const;
+
+    unsigned getTick() const;
+  };
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#include "../geometry/line.h"
+#include "../geometry/circle.h"
+#include "shape.h"
+
+namespace simulation {
+  Shape Shape::line(double x1, double y1, double x2, double y2) {
+    Shape shape = Shape();
+    shape.type = LINE;
+    shape.x1 = x1;
+    shape.y1 = y1;
+    shape.x2 = x2;
+    shape.y2 = y2;
+    return shape;
+  }
+
+  Shape Shape::circle(double x, double y, double r, double rad1, double rad2) {
+    Shape shape = Shape();
+    shape.type = CIRCLE;
+    shape.x = x;
+    shape.y = y;
+    shape.r = r;
+    shape.rad1 = rad1;
+    shape.rad2 = rad2;
+    return shape;
+  }
+
+  geometry::Line Shape::toLine() const {
+    return geometry::Line(x1, y1, x2, y2);
+  }
+
+  geometry::Circle Shape::toCircle() const {
+    return geometry::Circle(x, y, r, rad1, rad2);
+  }
+
+  // Returns if shapes have at least one intersection point, using the exact geometry
+  // intersection methods
+  bool Shape::intersects(const Shape& shape) const {
+    if (type == LINE) {
+      if (shape.type == LINE) return toLine().getIntersection(shape.toLine()).hasValue();
+      return toLine().getIntersection(shape.toCircle()).hasValue();
+    }
+
+    if (shape.type == LINE) return toCircle().getIntersection(shape.toLine()).hasValue();
+    return toCircle().getIntersection(shape.toCircle()).hasValue();
+  }
+
+  // Gets the shortest distance between the given point and the shape
+  double Shape::getDistance(double x, double y) const {
+    return type == LINE ? toLine().getDistance(x, y) : toCircle().getDistance(x, y);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "../geometry/line.h"
+#include "../geometry/circle.h"
+
+namespace simulation {
+  enum ShapeType {
+    LINE,
+    CIRCLE
+  };
+
+  // A plain value representation of either a line or a circle, so shapes can be
+  // stored and copied in bulk. A line uses the x1, y1, x2 and y2 values, and a
+  // circle uses the x, y, r, rad1 and rad2 values
+  struct Shape {
+    ShapeType type;
+    double x1;
+    double y1;
+    double x2;
+    double y2;
+    double x;
+    double y;
+    double r;
+    double rad1;
+    double rad2;
+
+    static Shape line(double x1, double y1, double x2, double y2);
+
+    static Shape circle(double x, double y, double r, double rad1, double rad2);
+
+    geometry::Line toLine() const;
+
+    geometry::Circle toCircle() const;
+
+    bool intersects(const Shape& shape) const;
+
+    double getDistance(double x, double y) const;
+  };
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <memory>
+#include "shape.h"
+#include "trail.h"
+
+namespace simulation {
+  // previous - The chunk which holds the shapes prior to this chunk
+  // offset - The number of shapes in all previous chunks
+  TrailChunk::TrailChunk(std::shared_ptr<TrailChunk> previous, unsigned offset):
+    _previous(previous),
+    _offset(offset),
+    _length(0) {
+  }
+
+  // An append-only list of shapes, stored as a linked list of fixed-size chunks.
+  // Chunks are shared between copies of the trail, which means that copying a trail
+  // is O(1). A chunk is only copied once a trail appends to a chunk which another
+  // trail has already appended to, i.e. when the trails start to diverge
+  Trail::Trail(): _size(0) {
+  }
+
+  unsigned Trail::size() const {
+    return _size;
+  }
+
+  // Gets the shape at the given index. Walks through the chunks, so it is O(chunks)
+  const Shape& Trail::at(unsigned index) const {
+    TrailChunk* chunk = _tail.get();
+    while (chunk->_offset > index) chunk = chunk->_previous.get();
+    return chunk->_shapes[index - chunk->_offset];
+  }
+
+  void Trail::push(const Shape& shape) {
+    unsigned index = _tail ? _size - _tail->_offset : TrailChunk::CAPACITY;
+
+    // Tail is full, start a new chunk
+    if (index == TrailChunk::CAPACITY) {
+      _tail = std::make_shared<TrailChunk>(_tail, _size);
+      _tail->_length = 1;
+      index = 0;
+    }
+    // Claim the next slot of the tail. If another trail has already claimed it, copy
+    // the part of the tail which is relevant for this trail so the other trail's shapes
+    // won't be overridden
+    else {
+      unsigned length = index;
+
+      if (!_tail->_length.compare_exchange_strong(length, index + 1)) {
+        std::shared_ptr<TrailChunk> tail =
+          std::make_shared<TrailChunk>(_tail->_previous, _tail->_offset);
+        std::copy(_tail->_shapes, _tail->_shapes + index, tail->_shapes);
+        tail->_length = index + 1;
+        _tail = tail;
+      }
+    }
+
+    _tail->_shapes[index] = shape;
+    _size++;
+  }
+
+  // Invokes the callback with each of the shapes in the range [0, end), starting from
+  // the most recent one, until the callback returns true
+  template <typename Callback>
+  bool Trail::some(unsigned end, Callback callback) const {
+    for (TrailChunk* chunk = _tail.get(); chunk; chunk = chunk->_previous.get()) {
+      if (chunk->_offset >= end) continue;
+
+      unsigned length = std::min(end, _size) - chunk->_offset;
+      if (length > TrailChunk::CAPACITY) length = TrailChunk::CAPACITY;
+
+      for (unsigned i = length; i > 0; i--) {
+        if (callback(chunk->_shapes[i - 1])) return true;
+      }
+    }
+
+    return false;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include "shape.h"
+
+namespace simulation {
+  class TrailChunk {
+  public:
+    static const unsigned CAPACITY = 64;
+
+    std::shared_ptr<TrailChunk> _previous;
+    unsigned _offset;
+    // Claimed atomically, since trails which share the chunk might live on different
+    // threads, e.g. see Pipeline
+    std::atomic<unsigned> _length;
+    Shape _shapes[CAPACITY];
+
+    TrailChunk(std::shared_ptr<TrailChunk> previous, unsigned offset);
+  };
+
+  class Trail {
+  private:
+    std::shared_ptr<TrailChunk> _tail;
+    unsigned _size;
+
+  public:
+    Trail();
+
+    unsigned size() const;
+
+    const Shape& at(unsigned index) const;
+
+    void push(const Shape& shape);
+
+    template <typename Callback>
+    bool some(unsigned end, Callback callback) const;
+  };
+}
\ No newline at end of file
@@ -0,0 +1,532 @@
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <emscripten/bind.h>
+#include "../utils.h"
+#include "shape.h"
+#include "trail.h"
+#include "occupancy_bitmap.h"
+#include "world.h"
+
+namespace simulation {
+  // A self contained representation of the game's state, i.e. the snakes and their
+  // trails, which can be stepped without JavaScript. Trails are persistent, so taking
+  // a snapshot of the world and restoring it is O(snakes) no matter how long the
+  // trails are, which makes rolling back and re-simulating ticks cheap.
+  // width - The width of the arena
+  // height - The height of the arena
+  // precision - Either "exact", in which case intersections are calculated based on the
+  // trails' geometry, or "px", in which case the trails are rasterized into an occupancy
+  // bitmap as they grow, and only the newly rasterized pixels are checked. The latter
+  // makes each step's cost independent of the trails' length
+  World::World(double width, double height, const std::string precision):
+    _width(width),
+    _height(height),
+    _tick(0),
+    _time(0),
+    _precision(precision),
+    _predictive(true),
+    _narrowphaseCount(0) {
+    // Last bits exceed the arena's bounds before snakes cycle through, and their
+    // geometry still counts, so the bitmap tracks a margin beyond the bounds as well
+    if (_precision.compare("px") == 0) {
+      _bitmap = OccupancyBitmap(
+        static_cast<int>(std::ceil(width)), static_cast<int>(std::ceil(height)), 16
+      );
+    }
+  }
+
+  // Adds a snake with the given initial values and returns its index.
+  // See Game.Entities.Snake for more information about the arguments
+  unsigned World::addSnake(double x, double y, double r, double rad, double v) {
+    Snake snake = Snake();
+    snake.x = x;
+    snake.y = y;
+    snake.r = r;
+    snake.rad = rad;
+    snake.v = v;
+    snake.alive = true;
+    snake.direction = STRAIGHT;
+    snake.input = STRAIGHT;
+    // A snake starts with a line
+    snake.currentShape = Shape::line(x, y, x, y);
+    snake.lastBit = snake.currentShape;
+    snake.pixelsCount = 0;
+    snake.shapeSequence = 0;
+    snake.graceSequence = 0;
+    snake.impactTime = -1;
+
+    // The new snake might be in the way of the rest of the snakes
+    for (unsigned i = 0; i < _snakes.size(); i++) {
+      _snakes.at(i).impactTime = -1;
+    }
+
+    _snakes.push_back(snake);
+    return _snakes.size() - 1;
+  }
+
+  // Sets the direction of the snake for the next steps, either "left", "right"
+  // or anything else for going straight
+  void World::setDirection(unsigned index, const std::string direction) {
+    Snake& snake = _snakes.at(index);
+
+    if (direction.compare("left") == 0)
+      snake.input = LEFT;
+    else if (direction.compare("right") == 0)
+      snake.input = RIGHT;
+    else
+      snake.input = STRAIGHT;
+  }
+
+  // Moves all snakes based on the elapsed time in ms and disqualifies the ones which
+  // intersected. Snakes are disqualified only once all of them have moved, so the
+  // result doesn't depend on the snakes' order
+  void World::step(double span) {
+    for (unsigned i = 0; i < _snakes.size(); i++) {
+      Snake& snake = _snakes.at(i);
+      if (!snake.alive) continue;
+
+      if (snake.input != snake.direction) turn(snake, snake.input);
+      advance(snake, (snake.v * span) / 1000);
+      cycleThrough(snake);
+    }
+
+    _time += span;
+
+    std::vector<bool> intersections = _precision.compare("px") == 0 ?
+      getPixelIntersections() :
+      getExactIntersections();
+
+    for (unsigned i = 0; i < _snakes.size(); i++) {
+      if (intersections.at(i)) _snakes.at(i).alive = false;
+    }
+
+    _tick++;
+  }
+
+  // Returns which of the snakes have intersected during the recent step, based on
+  // their geometry. Snakes which are not expected to hit anything during the recent
+  // step, based on their time of impact, are not checked at all
+  std::vector<bool> World::getExactIntersections() {
+    std::vector<bool> intersections(_snakes.size(), false);
+
+    for (unsigned i = 0; i < _snakes.size(); i++) {
+      Snake& snake = _snakes.at(i);
+      if (!snake.alive) continue;
+
+      // Cached times of impact are not maintained while checking every snake
+      if (!_predictive) snake.impactTime = -1;
+      else if (!isImpactExpected(snake)) continue;
+
+      _narrowphaseCount++;
+
+      if (hasSelfIntersection(snake)) {
+        intersections.at(i) = true;
+        continue;
+      }
+
+      for (unsigned j = 0; j < _snakes.size() && !intersections.at(i); j++) {
+        const Snake& opponent = _snakes.at(j);
+        // Don't scan for intersection with self, obviously this will always be true
+        if (i == j || !opponent.alive) continue;
+        intersections.at(i) = hasSnakeIntersection(snake, opponent);
+      }
+
+      // Nothing was hit, which means that the time of impact is yet to come
+      if (_predictive && !intersections.at(i))
+        snake.impactTime = _time + getTimeOfImpact(snake);
+    }
+
+    return intersections;
+  }
+
+  // Returns if the snake might have hit something during the recent step. The cached
+  // time of impact is lowered if the other snakes' last bits are in the way
+  bool World::isImpactExpected(Snake& snake) {
+    if (snake.impactTime < 0) return true;
+
+    const Shape& shape = snake.currentShape;
+
+    // A circle which has completed a whole round has run into itself
+    if (shape.type == CIRCLE && std::abs(shape.rad1 - shape.rad2) >= 2 * M_PI)
+      return true;
+
+    bool expected = false;
+
+    for (unsigned i = 0; i < _snakes.size(); i++) {
+      const Snake& opponent = _snakes.at(i);
+      if (&opponent == &snake || !opponent.alive) continue;
+
+      // The last bits might have crossed each other during the recent step
+      if (snake.lastBit.intersects(opponent.lastBit)) expected = true;
+
+      snake.impactTime = std::min(
+        snake.impactTime,
+        _time + getTimeOfImpact(snake, opponent.lastBit)
+      );
+    }
+
+    // Leave a margin of a pixel for precision errors
+    double margin = snake.v > 0 ? 1000 / snake.v : 0;
+
+    return expected || snake.impactTime <= _time + margin;
+  }
+
+  // Gets the time in ms it would take the snake to hit any of the shapes which are
+  // relevant for its intersection, or the arena's bounds, if it keeps its direction
+  double World::getTimeOfImpact(const Snake& snake) const {
+    double time = INFINITY;
+
+    std::vector<Shape> bounds = {
+      Shape::line(0, 0, _width, 0),
+      Shape::line(_width, 0, _width, _height),
+      Shape::line(_width, _height, 0, _height),
+      Shape::line(0, _height, 0, 0)
+    };
+
+    for (unsigned i = 0; i < bounds.size(); i++) {
+      time = std::min(time, getTimeOfImpact(snake, bounds.at(i)));
+    }
+
+    auto minTime = [this, &snake, &time](const Shape& shape) {
+      time = std::min(time, getTimeOfImpact(snake, shape));
+      return false;
+    };
+
+    // Recent 2 shapes are excluded, see hasSelfIntersection
+    if (snake.trail.size()) snake.trail.some(snake.trail.size() - 1, minTime);
+
+    for (unsigned i = 0; i < _snakes.size(); i++) {
+      const Snake& opponent = _snakes.at(i);
+      if (&opponent == &snake || !opponent.alive) continue;
+
+      minTime(opponent.currentShape);
+      opponent.trail.some(opponent.trail.size(), minTime);
+    }
+
+    return time;
+  }
+
+  // Gets the time in ms it would take the snake to hit the given shape if it keeps its
+  // direction, or infinity if it never would
+  double World::getTimeOfImpact(const Snake& snake, const Shape& shape) const {
+    const Shape& path = snake.currentShape;
+    double time;
+
+    switch (snake.direction) {
+      case LEFT:
+      case RIGHT: {
+        double rad = snake.direction == LEFT ? path.rad1 : path.rad2;
+        double v = snake.direction == LEFT ? -snake.v : snake.v;
+
+        time = shape.type == LINE ?
+          shape.toLine().getArcTimeOfImpact(path.x, path.y, path.r, rad, v) :
+          shape.toCircle().getArcTimeOfImpact(path.x, path.y, path.r, rad, v);
+        break;
+      }
+      default:
+        time = shape.type == LINE ?
+          shape.toLine().getTimeOfImpact(snake.x, snake.y, snake.rad, snake.v) :
+          shape.toCircle().getTimeOfImpact(snake.x, snake.y, snake.rad, snake.v);
+    }
+
+    return time * 1000;
+  }
+
+  // Returns which of the snakes have intersected during the recent step, based on
+  // the occupancy bitmap. The last bits are rasterized and occupied along the way
+  std::vector<bool> World::getPixelIntersections() {
+    std::vector<bool> intersections(_snakes.size(), false);
+    std::vector<std::vector<Pixel>> pixels(_snakes.size());
+
+    for (unsigned i = 0; i < _snakes.size(); i++) {
+      if (_snakes.at(i).alive) _bitmap.rasterize(_snakes.at(i).lastBit, pixels.at(i));
+    }
+
+    // All pixels are checked before any of them is occupied, so snakes which have
+    // moved into each other during this step would both be disqualified
+    for (unsigned i = 0; i < _snakes.size(); i++) {
+      if (_snakes.at(i).alive) intersections.at(i) = hasPixelIntersection(i, pixels);
+    }
+
+    // Pixels of snakes which were disqualified during this step are not occupied, and
+    // pixels of living snakes are never overridden, otherwise a trail which is no longer
+    // relevant, or a recent part of a trail, might hide an older relevant one
+    for (unsigned i = 0; i < _snakes.size(); i++) {
+      Snake& snake = _snakes.at(i);
+      if (intersections.at(i)) continue;
+
+      for (unsigned j = 0; j < pixels.at(i).size(); j++) {
+        const Pixel& pixel = pixels.at(i).at(j);
+        unsigned sequence = snake.pixelsCount++;
+
+        if (_bitmap.isOccupied(pixel) && _snakes.at(_bitmap.getOwner(pixel)).alive)
+          continue;
+
+        _bitmap.occupy(pixel, i, sequence);
+      }
+    }
+
+    return intersections;
+  }
+
+  // Pushes the current shape into the trail and starts a new one, based on the
+  // given direction
+  void World::turn(Snake& snake, Direction direction) {
+    snake.trail.push(snake.currentShape);
+    snake.direction = direction;
+    snake.graceSequence = snake.shapeSequence;
+    snake.shapeSequence = snake.pixelsCount;
+    // The snake is heading somewhere else now
+    snake.impactTime = -1;
+
+    switch (direction) {
+      case LEFT: {
+        double angle = snake.rad - (0.5 * M_PI);
+        double rad = snake.rad + (0.5 * M_PI);
+        double x = snake.x + (snake.r * std::cos(angle));
+        double y = snake.y + (snake.r * std::sin(angle));
+        snake.currentShape = Shape::circle(x, y, snake.r, rad, rad);
+        break;
+      }
+      case RIGHT: {
+        double angle = snake.rad + (0.5 * M_PI);
+        double rad = snake.rad - (0.5 * M_PI);
+        double x = snake.x + (snake.r * std::cos(angle));
+        double y = snake.y + (snake.r * std::sin(angle));
+        snake.currentShape = Shape::circle(x, y, snake.r, rad, rad);
+        break;
+      }
+      default:
+        snake.currentShape = Shape::line(snake.x, snake.y, snake.x, snake.y);
+    }
+  }
+
+  // Extends the current shape based on progress made, and updates the position of
+  // the snake and its last bit accordingly
+  void World::advance(Snake& snake, double step) {
+    Shape& shape = snake.currentShape;
+    double lastX = snake.x;
+    double lastY = snake.y;
+
+    switch (snake.direction) {
+      case LEFT: {
+        double lastRad = shape.rad1;
+        shape.rad1 -= step / snake.r;
+        snake.x = shape.x + (shape.r * std::cos(shape.rad1));
+        snake.y = shape.y + (shape.r * std::sin(shape.rad1));
+        snake.rad = shape.rad1 - (0.5 * M_PI);
+        snake.lastBit = Shape::circle(shape.x, shape.y, shape.r, shape.rad1, lastRad);
+        break;
+      }
+      case RIGHT: {
+        double lastRad = shape.rad2;
+        shape.rad2 += step / snake.r;
+        snake.x = shape.x + (shape.r * std::cos(shape.rad2));
+        snake.y = shape.y + (shape.r * std::sin(shape.rad2));
+        snake.rad = shape.rad2 + (0.5 * M_PI);
+        snake.lastBit = Shape::circle(shape.x, shape.y, shape.r, lastRad, shape.rad2);
+        break;
+      }
+      default:
+        shape.x2 += step * std::cos(snake.rad);
+        shape.y2 += step * std::sin(snake.rad);
+        snake.x = shape.x2;
+        snake.y = shape.y2;
+        snake.lastBit = Shape::line(lastX, lastY, snake.x, snake.y);
+    }
+  }
+
+  // Handles case where snake is out of the arena's limits and it should continue
+  // from the other side of it
+  void World::cycleThrough(Snake& snake) {
+    if (snake.x >= 0 && snake.x <= _width &&
+        snake.y >= 0 && snake.y <= _height) return;
+
+    snake.x = utils::mod(snake.x, _width);
+    snake.y = utils::mod(snake.y, _height);
+    // Start a new shape from the other side, with the same direction
+    turn(snake, snake.direction);
+  }
+
+  // Returns if the last bit intersects with the snake's own shapes, excluding the
+  // recent 2 shapes which the last bit is obviously attached to
+  bool World::hasSelfIntersection(const Snake& snake) const {
+    const Shape& shape = snake.currentShape;
+
+    // A circle which has completed a whole round has run into itself
+    if (shape.type == CIRCLE && std::abs(shape.rad1 - shape.rad2) >= 2 * M_PI)
+      return true;
+
+    if (!snake.trail.size()) return false;
+
+    return snake.trail.some(snake.trail.size() - 1, [&snake](const Shape& trailShape) {
+      return snake.lastBit.intersects(trailShape);
+    });
+  }
+
+  // Returns if the last bit intersects with any of the opponent's shapes
+  bool World::hasSnakeIntersection(const Snake& snake, const Snake& opponent) const {
+    if (snake.lastBit.intersects(opponent.currentShape)) return true;
+
+    return opponent.trail.some(opponent.trail.size(), [&snake](const Shape& trailShape) {
+      return snake.lastBit.intersects(trailShape);
+    });
+  }
+
+  // Returns if the newly rasterized pixels of the snake in the given index intersect with
+  // any occupied pixel, or with the newly rasterized pixels of other snakes. Own pixels
+  // are only relevant if they don't belong to the recent 2 shapes, and were not occupied
+  // in the recent few pixels, e.g. when the previous shape is shorter than a pixel
+  bool World::hasPixelIntersection(unsigned index,
+                                   const std::vector<std::vector<Pixel>>& pixels) const {
+    const Snake& snake = _snakes.at(index);
+    const std::vector<Pixel>& snakePixels = pixels.at(index);
+    const unsigned gracePixels = 4;
+    const Shape& shape = snake.currentShape;
+
+    // A circle which has completed a whole round has run into itself
+    if (shape.type == CIRCLE && std::abs(shape.rad1 - shape.rad2) >= 2 * M_PI)
+      return true;
+
+    unsigned graceSequence = snake.pixelsCount < gracePixels ?
+      0 : std::min(snake.graceSequence, snake.pixelsCount - gracePixels);
+
+    for (unsigned i = 0; i < snakePixels.size(); i++) {
+      const Pixel& pixel = snakePixels.at(i);
+      if (!_bitmap.isOccupied(pixel)) continue;
+
+      unsigned owner = _bitmap.getOwner(pixel);
+
+      if (owner == index) {
+        if (_bitmap.getSequence(pixel) < graceSequence) return true;
+      }
+      // Trails of disqualified snakes are no longer relevant
+      else if (_snakes.at(owner).alive) {
+        return true;
+      }
+    }
+
+    for (unsigned j = 0; j < _snakes.size(); j++) {
+      if (j == index || !_snakes.at(j).alive) continue;
+
+      for (unsigned i = 0; i < snakePixels.size(); i++) {
+        const Pixel& pixel = snakePixels.at(i);
+
+        if (std::any_of(pixels.at(j).begin(), pixels.at(j).end(), [&pixel](const Pixel& opponentPixel) {
+          return pixel.x == opponentPixel.x && pixel.y == opponentPixel.y;
+        })) return true;
+      }
+    }
+
+    return false;
+  }
+
+  World World::snapshot() const {
+    return *this;
+  }
+
+  void World::restore(const World& world) {
+    *this = world;
+  }
+
+  unsigned World::getSnakesCount() const {
+    return _snakes.size();
+  }
+
+  bool World::isAlive(unsigned index) const {
+    return _snakes.at(index).alive;
+  }
+
+  double World::getX(unsigned index) const {
+    return _snakes.at(index).x;
+  }
+
+  double World::getY(unsigned index) const {
+    return _snakes.at(index).y;
+  }
+
+  double World::getRad(unsigned index) const {
+    return _snakes.at(index).rad;
+  }
+
+  // Including the current shape
+  unsigned World::getShapesCount(unsigned index) const {
+    return _snakes.at(index).trail.size() + 1;
+  }
+
+  // Gets the shortest distance between the last bit of the snake in the given index and
+  // the shapes it can intersect with, i.e. its own shapes excluding the recent 2, and the
+  // shapes of the rest of the snakes, including disqualified ones. The last bit is sampled
+  // every quarter of a pixel. Used to tell how far a snake which was disqualified in px
+  // precision was from an actual hit
+  double World::getClearance(unsigned index) const {
+    const Snake& snake = _snakes.at(index);
+    const Shape& lastBit = snake.lastBit;
+    double length = lastBit.type == LINE ?
+      std::hypot(lastBit.x2 - lastBit.x1, lastBit.y2 - lastBit.y1) :
+      std::abs(lastBit.rad2 - lastBit.rad1) * lastBit.r;
+    int samplesCount = static_cast<int>(std::ceil(length / 0.25)) + 1;
+    double clearance = INFINITY;
+
+    auto minDistance = [&lastBit, samplesCount, &clearance](const Shape& shape) {
+      for (int i = 0; i < samplesCount; i++) {
+        double t = samplesCount > 1 ? static_cast<double>(i) / (samplesCount - 1) : 0;
+        double x;
+        double y;
+
+        if (lastBit.type == LINE) {
+          x = lastBit.x1 + (t * (lastBit.x2 - lastBit.x1));
+          y = lastBit.y1 + (t * (lastBit.y2 - lastBit.y1));
+        }
+        else {
+          double rad = lastBit.rad1 + (t * (lastBit.rad2 - lastBit.rad1));
+          x = lastBit.x + (lastBit.r * std::cos(rad));
+          y = lastBit.y + (lastBit.r * std::sin(rad));
+        }
+
+        clearance = std::min(clearance, shape.getDistance(x, y));
+      }
+
+      return false;
+    };
+
+    if (snake.trail.size()) snake.trail.some(snake.trail.size() - 1, minDistance);
+
+    for (unsigned i = 0; i < _snakes.size(); i++) {
+      const Snake& opponent = _snakes.at(i);
+      if (i == index) continue;
+
+      minDistance(opponent.currentShape);
+      opponent.trail.some(opponent.trail.size(), minDistance);
+    }
+
+    return clearance;
+  }
+}
+
+EMSCRIPTEN_BINDINGS(simulation_world_module) {
+  emscripten::class_<simulation::World>("simulation_world")
+    .constructor<double, double>()
+    .constructor<double, double, std::string>()
+    .property<double>("width", &simulation::World::_width)
+    .property<double>("height", &simulation::World::_height)
+    .property<unsigned>("tick", &simulation::World::_tick)
+    .property<double>("time", &simulation::World::_time)
+    .property<std::string>("precision", &simulation::World::_precision)
+    .property<bool>("predictive", &simulation::World::_predictive)
+    .property<unsigned>("narrowphaseCount", &simulation::World::_narrowphaseCount)
+    .function("addSnake", &simulation::World::addSnake)
+    .function("setDirection", &simulation::World::setDirection)
+    .function("step", &simulation::World::step)
+    .function("snapshot", &simulation::World::snapshot)
+    .function("restore", &simulation::World::restore)
+    .function("getSnakesCount", &simulation::World::getSnakesCount)
+    .function("isAlive", &simulation::World::isAlive)
+    .function("getX", &simulation::World::getX)
+    .function("getY", &simulation::World::getY)
+    .function("getRad", &simulation::World::getRad)
+    .function("getShapesCount", &simulation::World::getShapesCount)
+    .function("getClearance", &simulation::World::getClearance);
+}
\ No newline at end of file
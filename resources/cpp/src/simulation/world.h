@@ -0,0 +1,107 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "shape.h"
+#include "trail.h"
+#include "occupancy_bitmap.h"
+
+namespace simulation {
+  enum Direction {
+    STRAIGHT,
+    LEFT,
+    RIGHT
+  };
+
+  struct Snake {
+    double x;
+    double y;
+    double r;
+    double rad;
+    double v;
+    bool alive;
+    // The direction the snake is heading to, and the direction it was asked to
+    // head to during the next step
+    Direction direction;
+    Direction input;
+    // The shape which is being extended, it is not part of the trail yet
+    Shape currentShape;
+    // The progress made during the recent step
+    Shape lastBit;
+    Trail trail;
+    // The number of pixels the snake has occupied so far, and the pixel numbers at which
+    // the current shape and the shape before it have started. Used by the pixel precision
+    // to tell which of the snake's own pixels are too recent to intersect with
+    unsigned pixelsCount;
+    unsigned shapeSequence;
+    unsigned graceSequence;
+    // The time in ms in which the snake is expected to hit something if it keeps its
+    // direction. A negative value means that it has to be re-calculated
+    double impactTime;
+  };
+
+  class World {
+  private:
+    void turn(Snake& snake, Direction direction);
+
+    void advance(Snake& snake, double step);
+
+    void cycleThrough(Snake& snake);
+
+    std::vector<bool> getExactIntersections();
+
+    bool isImpactExpected(Snake& snake);
+
+    double getTimeOfImpact(const Snake& snake) const;
+
+    double getTimeOfImpact(const Snake& snake, const Shape& shape) const;
+
+    std::vector<bool> getPixelIntersections();
+
+    bool hasSelfIntersection(const Snake& snake) const;
+
+    bool hasSnakeIntersection(const Snake& snake, const Snake& opponent) const;
+
+    bool hasPixelIntersection(unsigned index, const std::vector<std::vector<Pixel>>& pixels) const;
+
+  public:
+    double _width;
+    double _height;
+    unsigned _tick;
+    double _time;
+    std::string _precision;
+    // Whether snakes are checked for intersections only when they are expected to hit
+    // something, based on their time of impact, and the number of snakes which were
+    // checked so far. Used to verify that skipping checks doesn't affect the results
+    bool _predictive;
+    unsigned _narrowphaseCount;
+    std::vector<Snake> _snakes;
+    OccupancyBitmap _bitmap;
+
+    World(double width, double height, const std::string precision = "exact");
+
+    unsigned addSnake(double x, double y, double r, double rad, double v);
+
+    void setDirection(unsigned index, const std::string direction);
+
+    void step(double span);
+
+    World snapshot() const;
+
+    void restore(const World& world);
+
+    unsigned getSnakesCount() const;
+
+    bool isAlive(unsigned index) const;
+
+    double getX(unsigned index) const;
+
+    double getY(unsigned index) const;
+
+    double getRad(unsigned index) const;
+
+    unsigned getShapesCount(unsigned index) const;
+
+    double getClearance(unsigned index) const;
+  };
+}
\ No newline at end of file
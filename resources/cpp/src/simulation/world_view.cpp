@@ -0,0 +1,125 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <emscripten/bind.h>
+#include <emscripten/val.h>
+#include "shape.h"
+#include "trail.h"
+#include "world.h"
+#include "world_view.h"
+
+namespace simulation {
+  // Converts the given shape into a plain object, which is either a line with x1, y1,
+  // x2 and y2 values or a circle with x, y, r, rad1 and rad2 values
+  static emscripten::val toVal(const Shape& shape) {
+    emscripten::val emShape = emscripten::val::object();
+
+    if (shape.type == LINE) {
+      emShape.set("type", emscripten::val(std::string("line")));
+      emShape.set("x1", emscripten::val(shape.x1));
+      emShape.set("y1", emscripten::val(shape.y1));
+      emShape.set("x2", emscripten::val(shape.x2));
+      emShape.set("y2", emscripten::val(shape.y2));
+    }
+    else {
+      emShape.set("type", emscripten::val(std::string("circle")));
+      emShape.set("x", emscripten::val(shape.x));
+      emShape.set("y", emscripten::val(shape.y));
+      emShape.set("r", emscripten::val(shape.r));
+      emShape.set("rad1", emscripten::val(shape.rad1));
+      emShape.set("rad2", emscripten::val(shape.rad2));
+    }
+
+    return emShape;
+  }
+
+  // A read-only copy of the snakes' state in the given world. Trails are shared with
+  // the world, but a trail is only appended to beyond the view's size, into slots
+  // which are claimed atomically, so the view can be handed over to other threads
+  // while the world keeps stepping. Creating a view is O(snakes).
+  // world - The world to view
+  WorldView::WorldView(const World& world):
+    _width(world._width),
+    _height(world._height),
+    _tick(world._tick),
+    _time(world._time) {
+    for (unsigned i = 0; i < world.getSnakesCount(); i++) {
+      SnakeView snake = SnakeView();
+      snake.x = world.getX(i);
+      snake.y = world.getY(i);
+      snake.rad = world.getRad(i);
+      snake.alive = world.isAlive(i);
+      snake.shapesCount = world.getShapesCount(i);
+      snake.trail = world._snakes.at(i).trail;
+      snake.currentShape = world._snakes.at(i).currentShape;
+      snake.lastBit = world._snakes.at(i).lastBit;
+      _snakes.push_back(snake);
+    }
+  }
+
+  unsigned WorldView::getSnakesCount() const {
+    return _snakes.size();
+  }
+
+  bool WorldView::isAlive(unsigned index) const {
+    return _snakes.at(index).alive;
+  }
+
+  double WorldView::getX(unsigned index) const {
+    return _snakes.at(index).x;
+  }
+
+  double WorldView::getY(unsigned index) const {
+    return _snakes.at(index).y;
+  }
+
+  double WorldView::getRad(unsigned index) const {
+    return _snakes.at(index).rad;
+  }
+
+  // Including the current shape
+  unsigned WorldView::getShapesCount(unsigned index) const {
+    return _snakes.at(index).shapesCount;
+  }
+
+  // Gets a shape of the snake's trail by its index. The shape which is being extended
+  // is the last one, and it would keep changing in the following ticks.
+  // index - The index of the snake
+  // shapeIndex - The index of the shape, up to the snake's shapes count
+  const Shape& WorldView::getShape(unsigned index, unsigned shapeIndex) const {
+    const SnakeView& snake = _snakes.at(index);
+    if (shapeIndex == snake.trail.size()) return snake.currentShape;
+    if (shapeIndex > snake.trail.size()) throw std::out_of_range("shapeIndex");
+    return snake.trail.at(shapeIndex);
+  }
+
+  // Gets the progress which the snake made during the recent tick
+  const Shape& WorldView::getLastBit(unsigned index) const {
+    return _snakes.at(index).lastBit;
+  }
+
+  emscripten::val WorldView::getEMShape(unsigned index, unsigned shapeIndex) const {
+    return toVal(getShape(index, shapeIndex));
+  }
+
+  emscripten::val WorldView::getEMLastBit(unsigned index) const {
+    return toVal(getLastBit(index));
+  }
+}
+
+EMSCRIPTEN_BINDINGS(simulation_world_view_module) {
+  emscripten::class_<simulation::WorldView>("simulation_world_view")
+    .constructor<const simulation::World&>()
+    .property<double>("width", &simulation::WorldView::_width)
+    .property<double>("height", &simulation::WorldView::_height)
+    .property<unsigned>("tick", &simulation::WorldView::_tick)
+    .property<double>("time", &simulation::WorldView::_time)
+    .function("getSnakesCount", &simulation::WorldView::getSnakesCount)
+    .function("isAlive", &simulation::WorldView::isAlive)
+    .function("getX", &simulation::WorldView::getX)
+    .function("getY", &simulation::WorldView::getY)
+    .function("getRad", &simulation::WorldView::getRad)
+    .function("getShapesCount", &simulation::WorldView::getShapesCount)
+    .function("getShape", &simulation::WorldView::getEMShape)
+    .function("getLastBit", &simulation::WorldView::getEMLastBit);
+}
\ No newline at end of file
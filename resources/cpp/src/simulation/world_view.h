@@ -0,0 +1,53 @@
+#pragma once
+
+#include <vector>
+#include <emscripten/val.h>
+#include "shape.h"
+#include "trail.h"
+#include "world.h"
+
+namespace simulation {
+  // The parts of a snake's state which are relevant for rendering. The trail is shared
+  // with the viewed snake, and it is only read up to its size
+  struct SnakeView {
+    double x;
+    double y;
+    double rad;
+    bool alive;
+    unsigned shapesCount;
+    Trail trail;
+    Shape currentShape;
+    Shape lastBit;
+  };
+
+  class WorldView {
+  public:
+    double _width;
+    double _height;
+    unsigned _tick;
+    double _time;
+    std::vector<SnakeView> _snakes;
+
+    WorldView(const World& world);
+
+    unsigned getSnakesCount() const;
+
+    bool isAlive(unsigned index) const;
+
+    double getX(unsigned index) const;
+
+    double getY(unsigned index) const;
+
+    double getRad(unsigned index) const;
+
+    unsigned getShapesCount(unsigned index) const;
+
+    const Shape& getShape(unsigned index, unsigned shapeIndex) const;
+
+    const Shape& getLastBit(unsigned index) const;
+
+    emscripten::val getEMShape(unsigned index, unsigned shapeIndex) const;
+
+    emscripten::val getEMLastBit(unsigned index) const;
+  };
+}
\ No newline at end of file
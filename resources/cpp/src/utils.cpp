@@ -51,8 +51,10 @@ namespace utils {
 
   template<typename T>
   T Chain<T>::result() {
+    // The accumulator has to be copied before the chain is deleted
+    T accumulator = _accumulator;
     delete this;
-    return _accumulator;
+    return accumulator;
   }
 
   template<typename T>
@@ -0,0 +1,157 @@
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "index.cpp"
+
+// A headless test of simulation::Pipeline with its worker thread, see the test:cpp
+// script in package.json. The pipeline is run along with a serially stepped world,
+// which shares trail chunks and bitmap tiles with the pipeline's world, and the
+// rendered frames are expected to match the serial world's states
+
+// A stand-in renderer which feeds a trail buffer for each snake with the viewed trails,
+// like the game does, and records the rendered frames instead of drawing them
+struct Frame {
+  std::vector<simulation::SnakeView> snakes;
+  std::vector<unsigned> vertexCounts;
+};
+
+struct Renderer {
+  std::vector<graphics::TrailBuffer> trailBuffers;
+  std::vector<unsigned> pushedCounts;
+  std::vector<Frame> frames;
+
+  void render(const simulation::WorldView& view) {
+    Frame frame;
+    frame.snakes = view._snakes;
+
+    for (unsigned i = 0; i < view.getSnakesCount(); i++) {
+      if (i == trailBuffers.size()) {
+        trailBuffers.push_back(graphics::TrailBuffer(0.25));
+        pushedCounts.push_back(0);
+      }
+
+      // The recent pushed shape might have been extended since
+      unsigned shapesCount = view.getShapesCount(i);
+      if (pushedCounts.at(i)) update(i, view.getShape(i, pushedCounts.at(i) - 1));
+
+      for (unsigned j = pushedCounts.at(i); j < shapesCount; j++) {
+        push(i, view.getShape(i, j));
+      }
+
+      pushedCounts.at(i) = shapesCount;
+      frame.vertexCounts.push_back(trailBuffers.at(i).getVertexCount());
+    }
+
+    frames.push_back(frame);
+  }
+
+  void push(unsigned index, const simulation::Shape& shape) {
+    if (shape.type == simulation::LINE)
+      trailBuffers.at(index).pushLine(shape.toLine());
+    else
+      trailBuffers.at(index).pushCircle(shape.toCircle());
+  }
+
+  void update(unsigned index, const simulation::Shape& shape) {
+    if (shape.type == simulation::LINE)
+      trailBuffers.at(index).updateLine(shape.toLine());
+    else
+      trailBuffers.at(index).updateCircle(shape.toCircle());
+  }
+};
+
+// Gets the direction of the snake in the given index at the given tick
+std::string getDirection(unsigned index, unsigned tick) {
+  const char* directions[] = { "left", "", "right" };
+  return directions[(tick / (index ? 4 : 3)) % 3];
+}
+
+bool isSame(const simulation::Shape& shape, const simulation::Shape& other) {
+  return shape.type == other.type &&
+         shape.x1 == other.x1 && shape.y1 == other.y1 &&
+         shape.x2 == other.x2 && shape.y2 == other.y2 &&
+         shape.x == other.x && shape.y == other.y && shape.r == other.r &&
+         shape.rad1 == other.rad1 && shape.rad2 == other.rad2;
+}
+
+bool isSame(const Frame& frame, const Frame& other, unsigned index) {
+  const simulation::SnakeView& snake = frame.snakes.at(index);
+  const simulation::SnakeView& otherSnake = other.snakes.at(index);
+
+  return snake.x == otherSnake.x &&
+         snake.y == otherSnake.y &&
+         snake.rad == otherSnake.rad &&
+         snake.alive == otherSnake.alive &&
+         snake.shapesCount == otherSnake.shapesCount &&
+         isSame(snake.currentShape, otherSnake.currentShape) &&
+         isSame(snake.lastBit, otherSnake.lastBit) &&
+         frame.vertexCounts.at(index) == other.vertexCounts.at(index);
+}
+
+// Returns the number of frames which don't match serial stepping
+unsigned test(const std::string precision) {
+  simulation::World world(800, 600, precision);
+  world.addSnake(200, 150, 50, M_PI / 4, 100);
+  world.addSnake(600, 450, 50, (-M_PI / 4) * 3, 100);
+
+  // Grow some trails first, so they would be shared with the pipeline's world
+  for (unsigned tick = 0; tick < 200; tick++) {
+    for (unsigned i = 0; i < 2; i++) world.setDirection(i, getDirection(i, tick));
+    world.step(16);
+  }
+
+  // Directions which were set before the pipeline was created should carry on, so
+  // they are not set again during the first tick
+  world.setDirection(1, "right");
+  simulation::Pipeline pipeline(world);
+  Renderer renderer;
+  Renderer serialRenderer;
+
+  for (unsigned tick = 0; tick < 400; tick++) {
+    pipeline.collect();
+
+    for (unsigned i = 0; i < 2; i++) {
+      if (!tick) break;
+      pipeline.setDirection(i, getDirection(i, tick));
+      world.setDirection(i, getDirection(i, tick));
+    }
+
+    pipeline.submit(16);
+    // Rendering and stepping the serial world overlap with the worker
+    renderer.render(pipeline.getFront());
+    serialRenderer.render(simulation::WorldView(world));
+    world.step(16);
+  }
+
+  pipeline.collect();
+  renderer.render(pipeline.getFront());
+  serialRenderer.render(simulation::WorldView(world));
+
+  unsigned mismatches = 0;
+  unsigned framesCount = serialRenderer.frames.size();
+
+  for (unsigned i = 0; i < framesCount; i++) {
+    for (unsigned j = 0; j < 2; j++) {
+      if (!isSame(renderer.frames.at(i), serialRenderer.frames.at(i), j)) {
+        mismatches++;
+        break;
+      }
+    }
+  }
+
+  std::printf("%s precision: %u/%u mismatching frames\n",
+    precision.c_str(), mismatches, framesCount);
+
+  return mismatches;
+}
+
+int main() {
+#ifndef SIMULATION_THREADS
+  std::printf("the pipeline was compiled without a worker thread\n");
+  return 1;
+#endif
+
+  unsigned mismatches = test("exact") + test("px");
+  return mismatches ? 1 : 0;
+}
\ No newline at end of file
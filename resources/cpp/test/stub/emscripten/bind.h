@@ -0,0 +1,40 @@
+#pragma once
+
+#include "val.h"
+
+// A native stand-in for Emscripten's bind.h. The bindings are compiled into unused
+// functions, so they are still type checked against the sources
+#define EMSCRIPTEN_BINDINGS(name) __attribute__((unused)) static void name##_init()
+
+namespace emscripten {
+  template <typename... Classes>
+  struct base {};
+
+  template <typename Signature, typename Class>
+  Signature Class::* select_overload(Signature Class::* method) {
+    return method;
+  }
+
+  template <typename Signature>
+  Signature* select_overload(Signature* function) {
+    return function;
+  }
+
+  template <typename Function>
+  void function(const char*, Function) {}
+
+  template <typename Class, typename Base = void>
+  class class_ {
+  public:
+    class_(const char*) {}
+
+    template <typename... Args>
+    class_& constructor() { return *this; }
+
+    template <typename T, typename Field>
+    class_& property(const char*, Field) { return *this; }
+
+    template <typename Method>
+    class_& function(const char*, Method) { return *this; }
+  };
+}
\ No newline at end of file
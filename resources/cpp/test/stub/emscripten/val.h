@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+
+// A native stand-in for Emscripten's val.h, so the sources can be compiled and tested
+// headlessly with a regular compiler. Values are never passed to JavaScript natively,
+// so all operations are no-ops
+namespace emscripten {
+  template <typename T>
+  struct memory_view {
+    size_t size;
+    const T* data;
+  };
+
+  template <typename T>
+  memory_view<T> typed_memory_view(size_t size, const T* data) {
+    return { size, data };
+  }
+
+  class val {
+  public:
+    val() {}
+
+    template <typename T>
+    explicit val(T) {}
+
+    static val undefined() { return val(); }
+
+    static val null() { return val(); }
+
+    static val object() { return val(); }
+
+    static val array() { return val(); }
+
+    template <typename K, typename V>
+    void set(K, V) {}
+  };
+}
\ No newline at end of file
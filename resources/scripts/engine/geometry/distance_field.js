@@ -0,0 +1,17 @@
+Engine.Geometry.DistanceField = class DistanceField extends Utils.proxy(CPP.Geometry.DistanceField) {
+  // Adds the given shape to the field. Only the distances around the shape are
+  // updated, so shapes can be added as they are being created
+  addShape(shape) {
+    if (shape instanceof Engine.Geometry.Line)
+      return this.addLine(shape);
+    if (shape instanceof Engine.Geometry.Circle)
+      return this.addCircle(shape);
+    if (shape instanceof Engine.Geometry.Polygon)
+      return this.addPolygon(shape);
+  }
+
+  // Adds each of the polygon's bounds, e.g. the canvas walls
+  addPolygon(polygon) {
+    polygon.bounds.forEach(bound => this.addLine(bound));
+  }
+};
\ No newline at end of file
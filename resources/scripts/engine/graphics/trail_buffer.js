@@ -0,0 +1,35 @@
+Engine.Graphics.TrailBuffer = class TrailBuffer extends Utils.proxy(CPP.Graphics.TrailBuffer) {
+  // Starts a new shape in the trail, previous shapes will not be tessellated again
+  push(shape) {
+    if (shape instanceof Engine.Geometry.Line)
+      return this.pushLine(shape);
+    if (shape instanceof Engine.Geometry.Circle)
+      return this.pushCircle(shape);
+  }
+
+  // Re-tessellates the recent shape in the trail, should be called whenever it changes
+  update(shape) {
+    if (shape instanceof Engine.Geometry.Line)
+      return this.updateLine(shape);
+    if (shape instanceof Engine.Geometry.Circle)
+      return this.updateCircle(shape);
+  }
+
+  // Draws the whole trail on the given context as a single path
+  draw(context) {
+    let vertices = this.getVertices();
+    let lastX;
+    let lastY;
+
+    for (let i = 0; i < vertices.length; i += 4) {
+      // Segments are only moved to when they are not continuous, e.g. when the trail
+      // cycles through the canvas, so joints between segments remain smooth
+      if (vertices[i] !== lastX || vertices[i + 1] !== lastY)
+        context.moveTo(vertices[i], vertices[i + 1]);
+
+      context.lineTo(vertices[i + 2], vertices[i + 3]);
+      lastX = vertices[i + 2];
+      lastY = vertices[i + 3];
+    }
+  }
+};
\ No newline at end of file
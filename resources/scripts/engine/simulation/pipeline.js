@@ -0,0 +1,20 @@
+Engine.Simulation.Pipeline = class Pipeline extends Utils.proxy(CPP.Simulation.Pipeline) {
+  // Runs a single frame. The recent tick is collected and rendered using the given
+  // renderer, while the next tick is being simulated
+  frame(span, renderer) {
+    this.collect();
+    this.submit(span);
+
+    let view = this.getFront();
+    renderer.render(view);
+    view.delete();
+  }
+
+  // Returns a read-only view of the recent collected tick, which has to be deleted
+  // once done
+  getFront() {
+    let view = super.getFront();
+    Object.setPrototypeOf(view, Engine.Simulation.WorldView.prototype);
+    return view;
+  }
+};
\ No newline at end of file
@@ -0,0 +1,24 @@
+Engine.Simulation.World = class World extends Utils.proxy(CPP.Simulation.World) {
+  // Gets the state of the snake in the given index as a plain object
+  getSnake(index) {
+    return {
+      x: this.getX(index),
+      y: this.getY(index),
+      rad: this.getRad(index),
+      alive: this.isAlive(index),
+      shapesCount: this.getShapesCount(index)
+    };
+  }
+
+  // Gets the state of all snakes
+  getSnakes() {
+    return _.times(this.getSnakesCount(), index => this.getSnake(index));
+  }
+
+  // Returns a copy of the world, which has to be deleted once done
+  snapshot() {
+    let world = super.snapshot();
+    Object.setPrototypeOf(world, Engine.Simulation.World.prototype);
+    return world;
+  }
+};
\ No newline at end of file
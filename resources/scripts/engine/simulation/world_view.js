@@ -0,0 +1,45 @@
+Engine.Simulation.WorldView = class WorldView extends Utils.proxy(CPP.Simulation.WorldView) {
+  // Gets the state of the snake in the given index as a plain object, just like
+  // Engine.Simulation.World does
+  getSnake(index) {
+    return Engine.Simulation.World.prototype.getSnake.call(this, index);
+  }
+
+  // Gets the state of all snakes
+  getSnakes() {
+    return Engine.Simulation.World.prototype.getSnakes.call(this);
+  }
+
+  // Feeds the given trail buffer with the snake's trail. Shapes which were pushed
+  // already are not pushed again, only the recent pushed one is updated, since it
+  // might have been extended since. Returns the number of pushed shapes, which should
+  // be passed on the next call.
+  // index - The index of the snake
+  // trailBuffer - An Engine.Graphics.TrailBuffer
+  // pushedCount - The number of shapes which were pushed so far
+  feedTrail(index, trailBuffer, pushedCount = 0) {
+    let shapesCount = this.getShapesCount(index);
+
+    if (pushedCount) this.withGeometry(index, pushedCount - 1, (shape) => {
+      trailBuffer.update(shape);
+    });
+
+    for (let i = pushedCount; i < shapesCount; i++) this.withGeometry(index, i, (shape) => {
+      trailBuffer.push(shape);
+    });
+
+    return shapesCount;
+  }
+
+  // Invokes the callback with the shape in the given index as either an
+  // Engine.Geometry.Line or an Engine.Geometry.Circle, which is deleted right after
+  withGeometry(index, shapeIndex, callback) {
+    let shape = this.getShape(index, shapeIndex);
+    let geometry = shape.type == "line" ?
+      new Engine.Geometry.Line(shape.x1, shape.y1, shape.x2, shape.y2) :
+      new Engine.Geometry.Circle(shape.x, shape.y, shape.r, shape.rad1, shape.rad2);
+
+    callback(geometry);
+    geometry.delete();
+  }
+};
\ No newline at end of file
@@ -15,6 +15,10 @@ Game.Entities.Snake = class Snake {
     // A snake starts with a line
     this.currentShape = new Engine.Geometry.Line(x, y, x, y);
     this.shapes.push(this.currentShape);
+    // Shapes are tessellated into a single vertex buffer as they grow, so the whole
+    // snake can be drawn at once
+    this.trail = new Engine.Graphics.TrailBuffer(0.25);
+    this.trail.push(this.currentShape);
     // A score can be provided in case we want to reserve previous scores from
     // recent matches
     this.score = options.score || 0;
@@ -33,22 +37,20 @@ Game.Entities.Snake = class Snake {
 
   delete() {
     this.shapes.forEach(shape => shape.delete());
+    this.trail.delete();
   }
 
   draw(context) {
-    // Draw all shapes in the shapes array
-    this.shapes.forEach(shape => {
-      context.save();
-      context.strokeStyle = this.color;
-      context.lineWidth = 3;
-      context.beginPath();
-
-      // Each shape has its own unique drawing method
-      shape.draw(context);
-
-      context.stroke();
-      context.restore();
-    });
+    // Draw all shapes in a single path using their tessellated trail
+    context.save();
+    context.strokeStyle = this.color;
+    context.lineWidth = 3;
+    context.beginPath();
+
+    this.trail.draw(context);
+
+    context.stroke();
+    context.restore();
   }
 
   update(span, width, height) {
@@ -63,6 +65,8 @@ Game.Entities.Snake = class Snake {
   updateShapes(step, width, height, options = {}) {
     this.updateCurrentShape(step, options);
     this.updateDirection(step, options);
+    // Only the current shape has changed, the rest of the trail remains as is
+    this.trail.update(this.currentShape);
   }
 
   // Updates current shape
@@ -147,6 +151,7 @@ Game.Entities.Snake = class Snake {
     }
 
     this.shapes.push(this.currentShape);
+    this.trail.push(this.currentShape);
   }
 
   // Extend the recent shape based on progress made
@@ -5,5 +5,7 @@ Game = {
 
 Engine = {
   Animations: {},
-  Geometry: {}
+  Geometry: {},
+  Graphics: {},
+  Simulation: {}
 };
\ No newline at end of file
@@ -59,6 +59,76 @@ describe("Engine.Geometry.Circle class", function() {
     });
   });
 
+  describe("getDistance method", function() {
+    describe("given point in rad range", function() {
+      it("returns distance from circumference", function() {
+        expect(this.circle.getDistance(1, 11)).toBeCloseTo(5);
+        expect(this.circle.getDistance(1, 3)).toBeCloseTo(3);
+      });
+    });
+
+    describe("given point out of rad range", function() {
+      it("returns distance from nearest end", function() {
+        expect(this.circle.getDistance(11, -4)).toBeCloseTo(Math.sqrt(50));
+      });
+    });
+
+    describe("given center point", function() {
+      it("returns radius", function() {
+        expect(this.circle.getDistance(1, 1)).toBeCloseTo(5);
+      });
+    });
+  });
+
+  describe("hasRad method", function() {
+    it("returns whether rad is in range", function() {
+      expect(this.circle.hasRad(Math.PI)).toBeTruthy();
+      expect(this.circle.hasRad(-Math.PI)).toBeTruthy();
+      expect(this.circle.hasRad(-Math.PI / 4)).toBeFalsy();
+    });
+  });
+
+  describe("getTimeOfImpact method", function() {
+    describe("given ray heading towards the arc", function() {
+      it("returns time until impact", function() {
+        expect(this.circle.getTimeOfImpact(1, 1, 0, 1)).toBeCloseTo(5);
+      });
+    });
+
+    describe("given ray heading towards the arc's gap", function() {
+      it("returns infinity", function() {
+        expect(this.circle.getTimeOfImpact(1, 1, -Math.PI / 4, 1)).toEqual(Infinity);
+      });
+    });
+
+    describe("given ray grazing the arc", function() {
+      it("returns time until impact", function() {
+        expect(this.circle.getTimeOfImpact(-4, 6 + 1e-7, 0, 1)).toBeCloseTo(5);
+      });
+    });
+  });
+
+  describe("getArcTimeOfImpact method", function() {
+    describe("given positive velocity", function() {
+      it("returns time until impact going counter clockwise", function() {
+        expect(this.circle.getArcTimeOfImpact(6, 1, 5, 0, 5)).toBeCloseTo((Math.PI / 3) * 2);
+      });
+    });
+
+    describe("given negative velocity", function() {
+      it("returns time until impact going clockwise", function() {
+        expect(this.circle.getArcTimeOfImpact(6, 1, 5, 0, -5)).toBeCloseTo((Math.PI / 3) * 4);
+      });
+    });
+
+    describe("given tangent circle grazing the arc's end", function() {
+      it("returns time until impact", function() {
+        expect(this.circle.getArcTimeOfImpact(11 + 1e-7, 1, 5, Math.PI / 2, 5))
+          .toBeCloseTo(Math.PI / 2);
+      });
+    });
+  });
+
   describe("getCircleIntersection method", function() {
     describe("given circle with 2 intersection points", function() {
       it("returns array with intersection points", function() {
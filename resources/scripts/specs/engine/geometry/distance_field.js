@@ -0,0 +1,77 @@
+describe("Engine.Geometry.DistanceField class", function() {
+  beforeEach(function() {
+    this.distanceField = new Engine.Geometry.DistanceField(100, 100, 2, 20);
+  });
+
+  afterEach(function () {
+    this.distanceField.delete();
+  });
+
+  describe("getDistance method", function() {
+    describe("given point near added line", function() {
+      it("returns distance from line", function() {
+        let line = new Engine.Geometry.Line(10, 50, 90, 50);
+        this.distanceField.addShape(line);
+        expect(this.distanceField.getDistance(50, 56)).toBeCloseTo(6);
+        line.delete();
+      });
+    });
+
+    describe("given point far from added shapes", function() {
+      it("returns max distance", function() {
+        let line = new Engine.Geometry.Line(10, 50, 90, 50);
+        this.distanceField.addShape(line);
+        expect(this.distanceField.getDistance(50, 10)).toBeCloseTo(20);
+        line.delete();
+      });
+    });
+  });
+
+  describe("sample method", function() {
+    describe("given point between nodes", function() {
+      it("returns interpolated distance", function() {
+        let line = new Engine.Geometry.Line(10, 50, 90, 50);
+        this.distanceField.addShape(line);
+        expect(this.distanceField.sample(50, 55)).toBeCloseTo(5);
+        expect(this.distanceField.sample(51, 51)).toBeCloseTo(1);
+        line.delete();
+      });
+    });
+
+    describe("given point near added circle", function() {
+      it("returns distance from arc", function() {
+        let circle = new Engine.Geometry.Circle(50, 50, 10, 0, Math.PI);
+        this.distanceField.addShape(circle);
+        expect(this.distanceField.sample(50, 64)).toBeCloseTo(4);
+        expect(this.distanceField.sample(50, 36)).toBeCloseTo(Math.sqrt(296));
+        circle.delete();
+      });
+    });
+
+    describe("given point near added polygon", function() {
+      it("returns distance from nearest bound", function() {
+        let polygon = new Engine.Geometry.Polygon(
+          [0, 0, 100, 0],
+          [100, 0, 100, 100],
+          [100, 100, 0, 100],
+          [0, 100, 0, 0]
+        );
+
+        this.distanceField.addShape(polygon);
+        expect(this.distanceField.sample(4, 50)).toBeCloseTo(4);
+        expect(this.distanceField.sample(50, 50)).toBeCloseTo(20);
+        polygon.delete();
+      });
+    });
+  });
+
+  describe("reset method", function() {
+    it("removes all added shapes", function() {
+      let line = new Engine.Geometry.Line(10, 50, 90, 50);
+      this.distanceField.addShape(line);
+      this.distanceField.reset();
+      expect(this.distanceField.getDistance(50, 50)).toBeCloseTo(20);
+      line.delete();
+    });
+  });
+});
\ No newline at end of file
@@ -51,6 +51,113 @@ describe("Engine.Geometry.Line class", function() {
         expect(this.line.hasPoint(x, y)).toBeFalsy();
       });
     });
+
+    describe("given point returned by getY on a sloped line", function() {
+      it("returns true", function() {
+        let line = new Engine.Geometry.Line(0, 0, 3, 1);
+        expect(line.hasPoint(1, line.getY(1))).toBeTruthy();
+        line.delete();
+      });
+    });
+
+    describe("given point returned by getX on a sloped line", function() {
+      it("returns true", function() {
+        let line = new Engine.Geometry.Line(0, 0, 1, 3);
+        expect(line.hasPoint(line.getX(1), 1)).toBeTruthy();
+        line.delete();
+      });
+    });
+
+    describe("given vertical line", function() {
+      it("returns whether point is contained", function() {
+        let line = new Engine.Geometry.Line(3, -2, 3, 8);
+
+        expect(line.hasPoint(3, 0)).toBeTruthy();
+        expect(line.hasPoint(3, 9)).toBeFalsy();
+        expect(line.hasPoint(3.1, 0)).toBeFalsy();
+
+        line.delete();
+      });
+    });
+
+    describe("given degenerate line", function() {
+      it("returns whether point is the line's only point", function() {
+        let line = new Engine.Geometry.Line(2, 2, 2, 2);
+
+        expect(line.hasPoint(2, 2)).toBeTruthy();
+        expect(line.hasPoint(2, 3)).toBeFalsy();
+
+        line.delete();
+      });
+    });
+  });
+
+  describe("getDistance method", function() {
+    describe("given point facing the line", function() {
+      it("returns distance from line", function() {
+        expect(this.line.getDistance(1, -1)).toBeCloseTo(Math.sqrt(2));
+      });
+    });
+
+    describe("given point beyond the line's end", function() {
+      it("returns distance from nearest end", function() {
+        expect(this.line.getDistance(8, 9)).toBeCloseTo(5);
+      });
+    });
+
+    describe("given contained point", function() {
+      it("returns 0", function() {
+        expect(this.line.getDistance(1, 1)).toBeCloseTo(0);
+      });
+    });
+  });
+
+  describe("getTimeOfImpact method", function() {
+    describe("given ray heading towards the line", function() {
+      it("returns time until impact", function() {
+        expect(this.line.getTimeOfImpact(-5, 5, -Math.PI / 4, Math.sqrt(2))).toBeCloseTo(5);
+      });
+    });
+
+    describe("given ray heading away from the line", function() {
+      it("returns infinity", function() {
+        expect(this.line.getTimeOfImpact(-5, 5, (Math.PI / 4) * 3, Math.sqrt(2))).toEqual(Infinity);
+      });
+    });
+
+    describe("given ray grazing the line's end", function() {
+      it("returns time until impact", function() {
+        expect(this.line.getTimeOfImpact(5 + 1e-7, 0, Math.PI / 2, 1)).toBeCloseTo(5);
+      });
+    });
+  });
+
+  describe("getArcTimeOfImpact method", function() {
+    describe("given positive velocity", function() {
+      it("returns time until impact going counter clockwise", function() {
+        expect(this.line.getArcTimeOfImpact(0, 0, 2, -Math.PI / 2, Math.PI / 2)).toBeCloseTo(3);
+      });
+    });
+
+    describe("given negative velocity", function() {
+      it("returns time until impact going clockwise", function() {
+        expect(this.line.getArcTimeOfImpact(0, 0, 2, -Math.PI / 2, -Math.PI / 2)).toBeCloseTo(1);
+      });
+    });
+
+    describe("given arc which never crosses the line", function() {
+      it("returns infinity", function() {
+        expect(this.line.getArcTimeOfImpact(20, 0, 2, 0, 1)).toEqual(Infinity);
+      });
+    });
+
+    describe("given arc grazing the line's end", function() {
+      it("returns time until impact", function() {
+        let line = new Engine.Geometry.Line(0, 2, 5, 2);
+        expect(line.getArcTimeOfImpact(0, 0, 2 - 1e-7, 0, 1)).toBeCloseTo(Math.PI);
+        line.delete();
+      });
+    });
   });
 
   describe("getLineIntersection method", function() {
@@ -75,6 +182,51 @@ describe("Engine.Geometry.Line class", function() {
       });
     });
 
+    describe("given line touching the line's end", function() {
+      it("returns the end point", function() {
+        let line = new Engine.Geometry.Line(5, 5, 9, 0);
+
+        expect(this.line.getLineIntersection(line)).toEqual({
+          x: 5,
+          y: 5
+        });
+
+        line.delete();
+      });
+    });
+
+    describe("given line starting on a sloped line", function() {
+      it("returns the starting point", function() {
+        let slopedLine = new Engine.Geometry.Line(0, 0, 3, 1);
+        let y = slopedLine.getY(1);
+        let line = new Engine.Geometry.Line(1, y, 1, 5);
+
+        expect(slopedLine.getLineIntersection(line)).toEqual({
+          x: 1,
+          y: y
+        });
+
+        line.delete();
+        slopedLine.delete();
+      });
+    });
+
+    describe("given collinear line", function() {
+      it("returns nothing", function() {
+        let line = new Engine.Geometry.Line(0, 0, 10, 10);
+        expect(this.line.getLineIntersection(line)).toBeUndefined();
+        line.delete();
+      });
+    });
+
+    describe("given degenerate line", function() {
+      it("returns nothing", function() {
+        let line = new Engine.Geometry.Line(2, 2, 2, 2);
+        expect(this.line.getLineIntersection(line)).toBeUndefined();
+        line.delete();
+      });
+    });
+
     describe("given outranged line", function() {
       it("returns nothing", function() {
         let line = new Engine.Geometry.Line(10, 10, 10, 15);
@@ -0,0 +1,63 @@
+describe("Engine.Graphics.TrailBuffer class", function() {
+  beforeEach(function() {
+    this.trailBuffer = new Engine.Graphics.TrailBuffer(0.25);
+    this.line = new Engine.Geometry.Line(0, 0, 10, 0);
+    this.circle = new Engine.Geometry.Circle(10, 10, 10, -0.5 * Math.PI, 0);
+  });
+
+  afterEach(function () {
+    this.trailBuffer.delete();
+    this.line.delete();
+    this.circle.delete();
+  });
+
+  describe("push method", function() {
+    describe("given line", function() {
+      it("appends a single segment", function() {
+        this.trailBuffer.push(this.line);
+        expect(Array.from(this.trailBuffer.getVertices())).toEqual([0, 0, 10, 0]);
+      });
+    });
+
+    describe("given circle", function() {
+      it("appends segments within tolerance", function() {
+        this.trailBuffer.push(this.circle);
+        let vertices = this.trailBuffer.getVertices();
+
+        expect(this.trailBuffer.getVertexCount()).toEqual(vertices.length / 2);
+        expect(vertices.length / 4).toEqual(4);
+        expect(vertices[0]).toBeCloseTo(10);
+        expect(vertices[1]).toBeCloseTo(0);
+        expect(vertices[vertices.length - 2]).toBeCloseTo(20);
+        expect(vertices[vertices.length - 1]).toBeCloseTo(10);
+      });
+    });
+  });
+
+  describe("update method", function() {
+    it("re-tessellates the recent shape only", function() {
+      this.trailBuffer.push(this.line);
+      this.trailBuffer.push(this.circle);
+      this.circle.rad2 = 0.5 * Math.PI;
+      this.trailBuffer.update(this.circle);
+      let vertices = this.trailBuffer.getVertices();
+
+      expect(Array.from(vertices.slice(0, 4))).toEqual([0, 0, 10, 0]);
+      expect(vertices.length / 4).toEqual(1 + 8);
+      expect(vertices[vertices.length - 2]).toBeCloseTo(10);
+      expect(vertices[vertices.length - 1]).toBeCloseTo(20);
+    });
+  });
+
+  describe("draw method", function() {
+    it("draws continuous segments as a single path", function() {
+      let context = jasmine.createSpyObj("context", ["moveTo", "lineTo"]);
+      this.trailBuffer.push(this.line);
+      this.trailBuffer.push(this.circle);
+      this.trailBuffer.draw(context);
+
+      expect(context.moveTo.calls.count()).toEqual(1);
+      expect(context.lineTo.calls.count()).toEqual(1 + 4);
+    });
+  });
+});
\ No newline at end of file
@@ -0,0 +1,99 @@
+describe("Engine.Simulation.Pipeline class", function() {
+  beforeEach(function() {
+    this.world = new Engine.Simulation.World(800, 600);
+    this.world.addSnake(200, 150, 50, Math.PI / 4, 100);
+    this.world.addSnake(600, 450, 50, (-Math.PI / 4) * 3, 100);
+    this.pipeline = new Engine.Simulation.Pipeline(this.world);
+
+    // A stand-in renderer which records the rendered snakes instead of drawing them
+    this.renderer = {
+      frames: [],
+
+      render(world) {
+        this.frames.push(world.getSnakes());
+      }
+    };
+
+    this.directions = (tick) => [
+      ["left", "", "right"][Math.floor(tick / 30) % 3],
+      ["right", "left", ""][Math.floor(tick / 40) % 3]
+    ];
+  });
+
+  afterEach(function () {
+    this.pipeline.delete();
+    this.world.delete();
+  });
+
+  describe("frame method", function() {
+    it("renders the previous tick", function() {
+      this.pipeline.frame(16, this.renderer);
+      this.pipeline.frame(16, this.renderer);
+
+      expect(this.renderer.frames[0]).toEqual(this.world.getSnakes());
+      this.world.step(16);
+      expect(this.renderer.frames[1]).toEqual(this.world.getSnakes());
+    });
+
+    it("matches stepping the world directly", function() {
+      let frames = [];
+
+      _.times(300, (tick) => {
+        this.directions(tick).forEach((direction, index) => {
+          this.pipeline.setDirection(index, direction);
+          this.world.setDirection(index, direction);
+        });
+
+        frames.push(this.world.getSnakes());
+        this.pipeline.frame(16, this.renderer);
+        this.world.step(16);
+      });
+
+      expect(this.renderer.frames).toEqual(frames);
+    });
+
+    it("keeps directions which were set on the world", function() {
+      this.world.setDirection(0, "left");
+      let pipeline = new Engine.Simulation.Pipeline(this.world);
+
+      pipeline.submit(16);
+      pipeline.collect();
+      let view = pipeline.getFront();
+      this.world.step(16);
+
+      expect(view.getSnakes()).toEqual(this.world.getSnakes());
+      view.delete();
+      pipeline.delete();
+    });
+  });
+
+  describe("getFront method", function() {
+    it("returns a read-only view of the recent collected tick", function() {
+      this.pipeline.submit(16);
+      this.pipeline.collect();
+      let view = this.pipeline.getFront();
+
+      expect(view.tick).toEqual(1);
+      expect(view.step).toBeUndefined();
+      view.delete();
+    });
+  });
+
+  describe("collect method", function() {
+    describe("given pending tick", function() {
+      it("swaps it into the front", function() {
+        this.pipeline.submit(16);
+
+        expect(this.pipeline.collect()).toBeTruthy();
+        expect(this.pipeline.getTick()).toEqual(1);
+      });
+    });
+
+    describe("given no pending tick", function() {
+      it("returns false", function() {
+        expect(this.pipeline.collect()).toBeFalsy();
+        expect(this.pipeline.getTick()).toEqual(0);
+      });
+    });
+  });
+});
\ No newline at end of file
@@ -0,0 +1,264 @@
+describe("Engine.Simulation.World class", function() {
+  beforeEach(function() {
+    this.world = new Engine.Simulation.World(800, 600);
+    this.world.addSnake(200, 150, 50, Math.PI / 4, 100);
+    this.world.addSnake(600, 450, 50, (-Math.PI / 4) * 3, 100);
+
+    // Steps the world with a fixed sequence of directions
+    this.simulate = (world, ticks) => {
+      _.times(ticks, () => {
+        let tick = world.tick;
+        world.setDirection(0, ["left", "", "right"][Math.floor(tick / 30) % 3]);
+        world.setDirection(1, ["right", "left", ""][Math.floor(tick / 40) % 3]);
+        world.step(16);
+      });
+    };
+  });
+
+  afterEach(function () {
+    this.world.delete();
+  });
+
+  describe("step method", function() {
+    it("moves snakes based on elapsed time", function() {
+      this.world.step(1000);
+      let snake = this.world.getSnake(0);
+
+      expect(snake.x).toBeCloseTo(200 + (100 * Math.cos(Math.PI / 4)));
+      expect(snake.y).toBeCloseTo(150 + (100 * Math.sin(Math.PI / 4)));
+      expect(this.world.tick).toEqual(1);
+      expect(this.world.time).toEqual(1000);
+    });
+
+    it("cycles through arena bounds", function() {
+      this.world.step(2000);
+      let snake = this.world.getSnake(1);
+
+      expect(snake.x).toBeCloseTo(600 - (200 * Math.cos(Math.PI / 4)));
+      this.world.step(6000);
+      snake = this.world.getSnake(1);
+
+      expect(snake.x).toBeGreaterThan(0);
+      expect(snake.y).toBeGreaterThan(0);
+      expect(snake.shapesCount).toEqual(2);
+    });
+
+    it("disqualifies a snake which ran into itself", function() {
+      this.world.setDirection(0, "left");
+      _.times(200, () => this.world.step(16));
+
+      expect(this.world.isAlive(0)).toBeFalsy();
+    });
+  });
+
+  describe("snapshot method", function() {
+    it("is not affected by further steps", function() {
+      this.simulate(this.world, 100);
+      let snapshot = this.world.snapshot();
+      let snakes = snapshot.getSnakesCount();
+      let x = snapshot.getX(0);
+
+      this.simulate(this.world, 100);
+
+      expect(snapshot.getSnakesCount()).toEqual(snakes);
+      expect(snapshot.getX(0)).toEqual(x);
+      expect(snapshot.tick).toEqual(100);
+      snapshot.delete();
+    });
+  });
+
+  describe("restore method", function() {
+    it("re-simulates to an identical state", function() {
+      this.simulate(this.world, 100);
+      let snapshot = this.world.snapshot();
+      this.simulate(this.world, 100);
+      let snakes = this.world.getSnakes();
+
+      this.world.restore(snapshot);
+      expect(this.world.tick).toEqual(100);
+
+      this.simulate(this.world, 100);
+      expect(this.world.getSnakes()).toEqual(snakes);
+      snapshot.delete();
+    });
+  });
+
+  describe("given predictive stepping", function() {
+    // Both worlds are stepped with the same pseudo-random directions, only one of them
+    // checks every snake for intersections on every tick
+    it("skips most checks without affecting the results", function() {
+      let counts = [0, 0];
+
+      _.range(1, 21).forEach((seed) => {
+        let worlds = [this.world.snapshot(), this.world.snapshot()];
+        let [predictiveWorld, fullWorld] = worlds;
+        let random = () => {
+          seed = (Math.imul(seed, 1103515245) + 12345) >>> 0;
+          return (seed >>> 16) & 0x7fff;
+        };
+
+        fullWorld.predictive = false;
+
+        for (let tick = 0; tick < 2000 && fullWorld.isAlive(0) && fullWorld.isAlive(1); tick++) {
+          if (tick % 25 == 0) _.times(2, (index) => {
+            let direction = ["", "left", "right"][random() % 3];
+            worlds.forEach(world => world.setDirection(index, direction));
+          });
+
+          worlds.forEach(world => world.step(16));
+          expect(predictiveWorld.getSnakes()).toEqual(fullWorld.getSnakes());
+        }
+
+        worlds.forEach((world, index) => {
+          counts[index] += world.narrowphaseCount;
+          world.delete();
+        });
+      });
+
+      let [predictiveCount, fullCount] = counts;
+      expect(predictiveCount).toBeLessThan(fullCount / 10);
+    });
+
+    // Snakes of various radiuses and velocities, whose pseudo-random positions are
+    // prone to tangent and grazing contacts, e.g. seeds 56 and 408
+    it("detects grazing contacts", function() {
+      [..._.range(1, 21), 56, 408].forEach((seed) => {
+        let worlds = _.times(2, () => new Engine.Simulation.World(800, 600));
+        let [predictiveWorld, fullWorld] = worlds;
+        let random = () => {
+          seed = (Math.imul(seed, 1103515245) + 12345) >>> 0;
+          return (seed >>> 16) & 0x7fff;
+        };
+        let directionsSeed = seed;
+
+        seed = Math.imul(seed, 7919) >>> 0;
+        _.times(3, () => {
+          let [x, y, r, rad, v] = _.times(5, () => random() / 32767);
+          worlds.forEach((world) => {
+            world.addSnake(
+              100 + (x * 600), 100 + (y * 400), 30 + (r * 50), rad * 6.28, 60 + (v * 140)
+            );
+          });
+        });
+
+        seed = directionsSeed;
+        fullWorld.predictive = false;
+
+        for (let tick = 0; tick < 3000; tick++) {
+          if (tick % 25 == 0) _.times(3, (index) => {
+            let direction = ["", "left", "right"][random() % 3];
+            worlds.forEach(world => world.setDirection(index, direction));
+          });
+
+          worlds.forEach(world => world.step(16));
+          expect(predictiveWorld.getSnakes()).toEqual(fullWorld.getSnakes());
+          if (_.compact(_.times(3, index => fullWorld.isAlive(index))).length <= 1) break;
+        }
+
+        worlds.forEach(world => world.delete());
+      });
+    });
+  });
+
+  describe("given px precision", function() {
+    beforeEach(function() {
+      this.pxWorld = new Engine.Simulation.World(800, 600, "px");
+      this.pxWorld.addSnake(200, 150, 50, Math.PI / 4, 100);
+      this.pxWorld.addSnake(600, 450, 50, (-Math.PI / 4) * 3, 100);
+    });
+
+    afterEach(function () {
+      this.pxWorld.delete();
+    });
+
+    it("disqualifies a snake which ran into itself", function() {
+      this.pxWorld.setDirection(0, "left");
+      _.times(200, () => this.pxWorld.step(16));
+
+      expect(this.pxWorld.isAlive(0)).toBeFalsy();
+    });
+
+    it("re-simulates to an identical state", function() {
+      this.simulate(this.pxWorld, 100);
+      let snapshot = this.pxWorld.snapshot();
+      this.simulate(this.pxWorld, 300);
+      let snakes = this.pxWorld.getSnakes();
+
+      this.pxWorld.restore(snapshot);
+      this.simulate(this.pxWorld, 300);
+      expect(this.pxWorld.getSnakes()).toEqual(snakes);
+      snapshot.delete();
+    });
+
+    // Differential test against the exact precision. Both worlds are stepped with the
+    // same pseudo-random directions for as long as the same snakes are alive in both of
+    // them, so disqualified snakes' trails are involved as well. Pixels are coarser than
+    // geometry, so the px world might disqualify earlier, even hundreds of ticks earlier
+    // when snakes pass within a pixel of each other, but never later, and never while
+    // being more than a pixel and a half away from an actual hit
+    it("matches exact precision", function() {
+      _.range(1, 21).forEach((seed) => {
+        let worlds = ["exact", "px"].map((precision) => {
+          let world = new Engine.Simulation.World(800, 600, precision);
+          world.addSnake(200, 150, 50, Math.PI / 4, 100);
+          world.addSnake(600, 450, 50, (-Math.PI / 4) * 3, 100);
+          world.addSnake(200, 450, 50, -Math.PI / 4, 100);
+          return world;
+        });
+        let [exactWorld, pxWorld] = worlds;
+        let random = () => {
+          seed = (Math.imul(seed, 1103515245) + 12345) >>> 0;
+          return (seed >>> 16) & 0x7fff;
+        };
+        let getAlive = world => _.times(3, index => world.isAlive(index));
+
+        for (let tick = 0; tick < 2000; tick++) {
+          if (tick % 25 == 0) _.times(3, (index) => {
+            let direction = ["", "left", "right"][random() % 3];
+            worlds.forEach(world => world.setDirection(index, direction));
+          });
+
+          let alive = getAlive(pxWorld);
+          worlds.forEach(world => world.step(16));
+          let [exactAlive, pxAlive] = worlds.map(getAlive);
+
+          if (!_.isEqual(exactAlive, pxAlive)) {
+            _.times(3, (index) => {
+              // Never later
+              if (!exactAlive[index]) expect(pxAlive[index]).toBeFalsy();
+              // Both worlds have the exact same geometry up until this tick
+              if (alive[index] && !pxAlive[index] && exactAlive[index])
+                expect(pxWorld.getClearance(index)).not.toBeGreaterThan(1.5);
+            });
+
+            break;
+          }
+
+          if (_.compact(exactAlive).length <= 1) break;
+        }
+
+        worlds.forEach(world => world.delete());
+      });
+    });
+
+    describe("given trail of a snake which was disqualified on top of another trail", function() {
+      it("keeps the other trail", function() {
+        let worlds = ["exact", "px"].map((precision) => {
+          let world = new Engine.Simulation.World(800, 600, precision);
+          world.addSnake(100, 100, 50, 0, 100);
+          world.addSnake(150.5, 20.3, 50, Math.PI / 2, 100);
+          world.addSnake(150.5, 200, 50, -Math.PI / 2, 100);
+          _.times(100, () => world.step(16));
+          return world;
+        });
+
+        worlds.forEach((world) => {
+          expect(world.isAlive(0)).toBeTruthy();
+          expect(world.isAlive(1)).toBeFalsy();
+          expect(world.isAlive(2)).toBeFalsy();
+          world.delete();
+        });
+      });
+    });
+  });
+});
\ No newline at end of file
@@ -0,0 +1,85 @@
+describe("Engine.Simulation.WorldView class", function() {
+  beforeEach(function() {
+    this.world = new Engine.Simulation.World(800, 600);
+    this.world.addSnake(200, 150, 50, Math.PI / 4, 100);
+    this.world.addSnake(600, 450, 50, (-Math.PI / 4) * 3, 100);
+    this.world.setDirection(0, "left");
+    _.times(50, () => this.world.step(16));
+    this.view = new Engine.Simulation.WorldView(this.world);
+  });
+
+  afterEach(function () {
+    this.view.delete();
+    this.world.delete();
+  });
+
+  it("has the world's snakes", function() {
+    expect(this.view.getSnakes()).toEqual(this.world.getSnakes());
+    expect(this.view.tick).toEqual(this.world.tick);
+    expect(this.view.time).toEqual(this.world.time);
+  });
+
+  it("is not affected by further steps", function() {
+    let snakes = this.view.getSnakes();
+    _.times(50, () => this.world.step(16));
+
+    expect(this.view.getSnakes()).toEqual(snakes);
+  });
+
+  it("can't be stepped", function() {
+    expect(this.view.step).toBeUndefined();
+    expect(this.view.restore).toBeUndefined();
+    expect(this.view.snapshot).toBeUndefined();
+  });
+
+  describe("getShape method", function() {
+    it("has the snake's trail followed by the current shape", function() {
+      let shapesCount = this.view.getShapesCount(0);
+      let shape = this.view.getShape(0, shapesCount - 1);
+
+      expect(shapesCount).toBeGreaterThan(1);
+      expect(this.view.getShape(0, 0).type).toEqual("line");
+      expect(shape.type).toEqual("circle");
+      expect(shape.r).toEqual(50);
+      // Turning left moves the start of the arc
+      expect(shape.rad1).toBeCloseTo(this.view.getRad(0) + (Math.PI / 2));
+    });
+  });
+
+  describe("getLastBit method", function() {
+    it("ends at the snake's head", function() {
+      let lastBit = this.view.getLastBit(1);
+
+      expect(lastBit.type).toEqual("line");
+      expect(lastBit.x2).toEqual(this.view.getX(1));
+      expect(lastBit.y2).toEqual(this.view.getY(1));
+    });
+  });
+
+  describe("feedTrail method", function() {
+    it("feeds a trail buffer incrementally", function() {
+      let trailBuffer = new Engine.Graphics.TrailBuffer(0.25);
+      let wholeTrailBuffer = new Engine.Graphics.TrailBuffer(0.25);
+      let pushedCount = this.view.feedTrail(0, trailBuffer);
+
+      this.world.setDirection(0, "right");
+      _.times(50, () => {
+        this.world.step(16);
+        let view = new Engine.Simulation.WorldView(this.world);
+        pushedCount = view.feedTrail(0, trailBuffer, pushedCount);
+        view.delete();
+      });
+
+      let view = new Engine.Simulation.WorldView(this.world);
+      view.feedTrail(0, wholeTrailBuffer);
+
+      expect(pushedCount).toEqual(view.getShapesCount(0));
+      expect(Array.from(trailBuffer.getVertices()))
+        .toEqual(Array.from(wholeTrailBuffer.getVertices()));
+
+      view.delete();
+      trailBuffer.delete();
+      wholeTrailBuffer.delete();
+    });
+  });
+});
\ No newline at end of file
@@ -37,6 +37,26 @@ server.ext("onPreResponse", (req, rep) => {
   rep.continue();
 });
 
+// The pthreads build of the C++ bundle (npm run build:cpp:threads) relies on
+// SharedArrayBuffer, which browsers only provide to cross-origin isolated pages.
+// All resources are served from this server, so isolation costs nothing
+server.ext("onPreResponse", (req, rep) => {
+  let res = req.response;
+  let headers = {
+    "Cross-Origin-Opener-Policy": "same-origin",
+    "Cross-Origin-Embedder-Policy": "require-corp"
+  };
+
+  if (res.isBoom) {
+    Object.assign(res.output.headers, headers);
+  }
+  else {
+    Object.keys(headers).forEach(name => res.header(name, headers[name]));
+  }
+
+  rep.continue();
+});
+
 // Register all routes and plug-ins
 Async.series([
   next => server.register(Inert, next),